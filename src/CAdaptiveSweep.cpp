@@ -0,0 +1,208 @@
+/**
+ *
+ * @file CAdaptiveSweep.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CAdaptiveSweep source file.
+ *
+ * @details Contain the implementation of the class CAdaptiveSweep.
+ *
+ * @see CAdaptiveSweep.h
+ *
+ **/
+
+#include <vector>           // std::vector
+#include <unordered_map>    // std::unordered_map
+#include <algorithm>        // std::min
+#include <utility>          // std::make_pair
+
+#include "CAdaptiveSweep.h" // Class header
+#include "common.h"         // Settings struct, PI
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Finest level of the quadtree, the keys of the corners hold two coordinates of the lattice.
+    const unsigned MaxLevelLimit = 15;
+
+    // Tells if two runs have the same outcome.
+    bool SameOutcome (const CSweep::Result &First, const CSweep::Result &Second)
+    {
+        return First.Bounces == Second.Bounces && First.FirstImpact == Second.FirstImpact;
+
+    }// SameOutcome ()
+}
+
+// Initialize a sweep of the parameters queried at the time Time.
+CAdaptiveSweep::CAdaptiveSweep (const Settings &Parameters, double Time) : m_Parameters (Parameters), m_Time (Time),
+                                                                           m_MinAngle (0), m_MaxAngle (PI / 2), m_MinSpeed (0), m_MaxSpeed (40),
+                                                                           m_FirstLevel (3), m_MaxLevel (8), m_Sweep (Parameters, Time)
+{
+
+}// CAdaptiveSweep ()
+
+// Set the rectangle of angles and speeds.
+void CAdaptiveSweep::SetDomain (float MinAngle, float MaxAngle, float MinSpeed, float MaxSpeed)
+{
+    m_MinAngle = MinAngle;
+    m_MaxAngle = MaxAngle;
+    m_MinSpeed = MinSpeed;
+    m_MaxSpeed = MaxSpeed;
+
+}// SetDomain ()
+
+// Set the levels of the quadtree.
+void CAdaptiveSweep::SetLevels (unsigned FirstLevel, unsigned MaxLevel)
+{
+    m_MaxLevel = min (MaxLevel, MaxLevelLimit);
+    m_FirstLevel = min (FirstLevel, m_MaxLevel);
+
+}// SetLevels ()
+
+// Set the maximum number of threads, 0 for one per core.
+void CAdaptiveSweep::SetThreadCount (unsigned ThreadCount)
+{
+    m_Sweep.SetThreadCount (ThreadCount);
+
+}// SetThreadCount ()
+
+// Return the key of a corner of the lattice.
+unsigned long long CAdaptiveSweep::GetKey (unsigned X, unsigned Y) const
+{
+    return (unsigned long long) Y * (GetResolution () + 1) + X;
+
+}// GetKey ()
+
+// Return the number of finest cells per side.
+unsigned CAdaptiveSweep::GetResolution () const
+{
+    return 1u << m_MaxLevel;
+
+}// GetResolution ()
+
+// Return the angle of a column of the lattice.
+float CAdaptiveSweep::GetAngle (unsigned X) const
+{
+    return m_MinAngle + (m_MaxAngle - m_MinAngle) * X / GetResolution ();
+
+}// GetAngle ()
+
+// Return the speed of a row of the lattice.
+float CAdaptiveSweep::GetSpeed (unsigned Y) const
+{
+    return m_MinSpeed + (m_MaxSpeed - m_MinSpeed) * Y / GetResolution ();
+
+}// GetSpeed ()
+
+// Return the result of a corner.
+const CSweep::Result &CAdaptiveSweep::GetResult (unsigned X, unsigned Y) const
+{
+    return m_Results.find (GetKey (X, Y))->second;
+
+}// GetResult ()
+
+// Return the number of runs done.
+unsigned long long CAdaptiveSweep::GetRunCount () const
+{
+    return m_Results.size ();
+
+}// GetRunCount ()
+
+// Return the leaves of the quadtree.
+const vector <CAdaptiveSweep::Cell> &CAdaptiveSweep::GetLeaves () const
+{
+    return m_Leaves;
+
+}// GetLeaves ()
+
+// Run the corners of the cells not run yet.
+void CAdaptiveSweep::RunCorners (const vector <Cell> &Cells)
+{
+    vector <Settings> Runs;
+    vector <unsigned long long> Keys;
+
+    // A corner is kept the first time it is met, the same corner of the neighbour cells is found in the results.
+    for (unsigned i = 0; i < Cells.size (); ++i)
+        for (unsigned Corner = 0; Corner < 4; ++Corner)
+        {
+            unsigned X = Cells [i].X + (Corner & 1) * Cells [i].Size;
+            unsigned Y = Cells [i].Y + (Corner >> 1) * Cells [i].Size;
+            unsigned long long Key = GetKey (X, Y);
+
+            if (! m_Results.insert (make_pair (Key, CSweep::Result ())).second)
+                continue;
+
+            Settings Run = m_Parameters;
+            Run.Angle = GetAngle (X);
+            Run.Speed = GetSpeed (Y);
+            Run.Time = 0;
+            Run.TotalTime = 0;
+            Run.Dir = LEFTTORIGHT;
+
+            Runs.push_back (Run);
+            Keys.push_back (Key);
+        }
+
+    vector <CSweep::Result> Results;
+    m_Sweep.Run (Runs, Results);
+
+    for (unsigned i = 0; i < Keys.size (); ++i)
+        m_Results [Keys [i]] = Results [i];
+
+}// RunCorners ()
+
+// Refine the cells.
+void CAdaptiveSweep::Run ()
+{
+    m_Results.clear ();
+    m_Leaves.clear ();
+
+    // The first grid, every cell is checked.
+    unsigned Step = 1u << (m_MaxLevel - m_FirstLevel);
+    vector <Cell> Pending;
+    for (unsigned Y = 0; Y < GetResolution (); Y += Step)
+        for (unsigned X = 0; X < GetResolution (); X += Step)
+        {
+            Cell First = {X, Y, Step, false};
+            Pending.push_back (First);
+        }
+
+    // One level after the other, the corners of a level are run at once.
+    while (! Pending.empty ())
+    {
+        RunCorners (Pending);
+
+        vector <Cell> Next;
+        for (unsigned i = 0; i < Pending.size (); ++i)
+        {
+            Cell Current = Pending [i];
+            const CSweep::Result &Origin = GetResult (Current.X, Current.Y);
+            Current.Boundary = ! SameOutcome (Origin, GetResult (Current.X + Current.Size, Current.Y)) ||
+                               ! SameOutcome (Origin, GetResult (Current.X, Current.Y + Current.Size)) ||
+                               ! SameOutcome (Origin, GetResult (Current.X + Current.Size, Current.Y + Current.Size));
+
+            if (! Current.Boundary || Current.Size == 1)
+            {
+                m_Leaves.push_back (Current);
+                continue;
+            }
+
+            unsigned Half = Current.Size / 2;
+            for (unsigned Quarter = 0; Quarter < 4; ++Quarter)
+            {
+                Cell Child = {Current.X + (Quarter & 1) * Half, Current.Y + (Quarter >> 1) * Half, Half, false};
+                Next.push_back (Child);
+            }
+        }
+
+        Pending.swap (Next);
+    }
+
+}// Run ()
@@ -0,0 +1,107 @@
+/**
+ *
+ * @file CAdaptiveSweep.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CAdaptiveSweep header file.
+ *
+ * @details Contain declaration of the class CAdaptiveSweep, which maps the outcome of a launch (the number of bounces
+ *          and the wall touched first) over a rectangle of angles and speeds. The rectangle is cut into a regular grid
+ *          of cells, then each cell whose four corners do not have the same outcome is cut into four (a quadtree),
+ *          until the cells reach the finest size. The corners lie on the lattice of the finest cells : a corner shared
+ *          by several cells is run once. The corners of a level are run all together by a CSweep, on every core.
+ *          A region smaller than a cell, whose corners all have the same outcome, is not seen.
+ *
+ * @see CAdaptiveSweep.cpp
+ *
+ **/
+
+#ifndef __CADAPTIVESWEEP_H__
+#define __CADAPTIVESWEEP_H__
+
+#include <vector>           // std::vector
+#include <unordered_map>    // std::unordered_map
+
+#include "common.h"     // Settings struct
+#include "CSweep.h"     // Batch of runs
+
+/*
+** CAdaptiveSweep class that samples the angles and the speeds densely only where the outcome changes.
+*/
+class CAdaptiveSweep
+{
+    public :
+
+        // Store a leaf of the quadtree, in units of the finest cells.
+        struct Cell
+        {
+            unsigned X;                 // the column of its lowest angle.
+            unsigned Y;                 // the row of its lowest speed.
+            unsigned Size;              // the number of finest cells of its side.
+            bool Boundary;              // tells if its corners have different outcomes.
+        };
+
+        // Initialize a sweep of the parameters queried at the time Time, over the angles from 0 to 90 degrees and the speeds up to 40 m/s.
+        CAdaptiveSweep (const nsTools::Settings &Parameters, double Time);
+
+        // Set the rectangle of angles (rad) and speeds (m/s).
+        void SetDomain (float MinAngle, float MaxAngle, float MinSpeed, float MaxSpeed);
+
+        // Set the levels of the quadtree : the first grid has 2^FirstLevel cells per side, the finest one 2^MaxLevel (at most 15).
+        void SetLevels (unsigned FirstLevel, unsigned MaxLevel);
+
+        // Set the maximum number of threads, 0 for one per core.
+        void SetThreadCount (unsigned ThreadCount);
+
+        // Refine the cells, the previous leaves are forgotten.
+        void Run ();
+
+        // Return the leaves of the quadtree, in the order they were found.
+        const std::vector <Cell> &GetLeaves () const;
+
+        // Return the number of runs done, and the number of finest cells per side.
+        unsigned long long GetRunCount () const;
+        unsigned GetResolution () const;
+
+        // Return the angle of a column and the speed of a row of the lattice.
+        float GetAngle (unsigned X) const;
+        float GetSpeed (unsigned Y) const;
+
+        // Return the result of a corner of a leaf.
+        const CSweep::Result &GetResult (unsigned X, unsigned Y) const;
+
+    private :
+
+        // Return the key of a corner of the lattice.
+        unsigned long long GetKey (unsigned X, unsigned Y) const;
+
+        // Run the corners of the cells not run yet.
+        void RunCorners (const std::vector <Cell> &Cells);
+
+        // Parameters of the fields not swept, and time of the query.
+        nsTools::Settings m_Parameters;
+        double m_Time;
+
+        // Rectangle of angles and speeds.
+        float m_MinAngle;
+        float m_MaxAngle;
+        float m_MinSpeed;
+        float m_MaxSpeed;
+
+        // Levels of the first and of the finest grids.
+        unsigned m_FirstLevel;
+        unsigned m_MaxLevel;
+
+        // Runs of the list of settings.
+        CSweep m_Sweep;
+
+        // Results of the corners run, and leaves of the quadtree.
+        std::unordered_map <unsigned long long, CSweep::Result> m_Results;
+        std::vector <Cell> m_Leaves;
+};
+#endif // __CADAPTIVESWEEP_H__
@@ -0,0 +1,109 @@
+/**
+ *
+ * @file CBlockRunner.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CBlockRunner source file.
+ *
+ * @details Contain the implementation of the class CBlockRunner.
+ *
+ * @see CBlockRunner.h
+ *
+ **/
+
+#include <functional>   // std::function
+#include <algorithm>    // std::min
+
+#include "CBlockRunner.h"   // Class header
+
+using namespace std;
+
+namespace
+{
+    // Number of items of the pilot run by a single job.
+    const unsigned PilotGrain = 1024;
+}
+
+// Initialize a runner of Count items.
+CBlockRunner::CBlockRunner (unsigned long long Count, unsigned ThreadCount) : m_Count (Count), m_PilotCount ((unsigned) min (Count, (unsigned long long) PILOT_SIZE)),
+                                                                              m_Jobs (ThreadCount)
+{
+
+}// CBlockRunner ()
+
+// Return the number of items.
+unsigned long long CBlockRunner::GetCount () const
+{
+    return m_Count;
+
+}// GetCount ()
+
+// Return the number of items of the pilot.
+unsigned CBlockRunner::GetPilotCount () const
+{
+    return m_PilotCount;
+
+}// GetPilotCount ()
+
+// Return the item of the pilot Pilot.
+unsigned long long CBlockRunner::GetPilotItem (unsigned Pilot) const
+{
+    // The items of the pilot are spread over all of them, the first ones may only differ by their first settings.
+    return Pilot * m_Count / m_PilotCount;
+
+}// GetPilotItem ()
+
+// Return the place of an item in the pilot.
+unsigned CBlockRunner::FindPilot (unsigned long long Item) const
+{
+    // The pilot Pilot gives the item Pilot * m_Count / m_PilotCount : the only candidate is the smallest Pilot reaching Item.
+    unsigned long long Pilot = (Item * m_PilotCount + m_Count - 1) / m_Count;
+
+    return Pilot < m_PilotCount && GetPilotItem ((unsigned) Pilot) == Item ? (unsigned) Pilot : NO_PILOT;
+
+}// FindPilot ()
+
+// Call Body for every item of the pilot on the job system.
+void CBlockRunner::RunPilot (const function <void (unsigned, unsigned long long)> &Body)
+{
+    m_Jobs.ParallelFor (0, m_PilotCount, PilotGrain, [this, &Body] (unsigned First, unsigned Last)
+    {
+        for (unsigned Pilot = First; Pilot < Last; ++Pilot)
+            Body (Pilot, GetPilotItem (Pilot));
+    });
+
+}// RunPilot ()
+
+// Run every item, round after round.
+void CBlockRunner::RunBlocks (const function <void (unsigned, unsigned long long, unsigned long long)> &Block,
+                              const function <void (unsigned)> &Merge, const function <void ()> &Round/* = function <void ()> ()*/)
+{
+    unsigned long long BlockCount = (m_Count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    for (unsigned long long FirstBlock = 0; FirstBlock < BlockCount; FirstBlock += ROUND_BLOCKS)
+    {
+        unsigned RoundSize = (unsigned) min ((unsigned long long) ROUND_BLOCKS, BlockCount - FirstBlock);
+
+        // Each block is summed up by a single thread, in the order of its items.
+        m_Jobs.ParallelFor (0, RoundSize, 1, [this, &Block, FirstBlock] (unsigned First, unsigned Last)
+        {
+            for (unsigned Slot = First; Slot < Last; ++Slot)
+            {
+                unsigned long long Begin = (FirstBlock + Slot) * BLOCK_SIZE;
+                Block (Slot, Begin, min (m_Count, Begin + BLOCK_SIZE));
+            }
+        });
+
+        // The blocks are merged in their order, whatever the threads that ran them.
+        for (unsigned Slot = 0; Slot < RoundSize; ++Slot)
+            Merge (Slot);
+
+        if (Round)
+            Round ();
+    }
+
+}// RunBlocks ()
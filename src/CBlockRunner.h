@@ -0,0 +1,82 @@
+/**
+ *
+ * @file CBlockRunner.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CBlockRunner header file.
+ *
+ * @details Contain declaration of the class CBlockRunner, which sums up the outcomes of many independent items (the runs of a
+ *          sweep, the samples of a study) on a job system. A pilot of items spread over all of them is run first, to
+ *          give the bounds of the histograms. The items are then summed up by blocks, each one by a single job in the
+ *          order of its items, and the blocks of a round are merged by the caller in their order : the sums do not
+ *          depend on the number of threads. The outcomes of the pilot are kept by the caller and not computed again.
+ *
+ * @see CBlockRunner.cpp
+ *
+ **/
+
+#ifndef __CBLOCKRUNNER_H__
+#define __CBLOCKRUNNER_H__
+
+#include <functional>   // std::function
+
+#include "CJobSystem.h" // Job system
+
+// Number of consecutive items summed up by a single job.
+#define BLOCK_SIZE      4096ull
+
+// Number of blocks run together before being merged, it must not depend on the number of threads.
+#define ROUND_BLOCKS    64
+
+// Largest number of items of the pilot.
+#define PILOT_SIZE      65536u
+
+// Pilot of an item out of the pilot.
+#define NO_PILOT        0xFFFFFFFFu
+
+/*
+** CBlockRunner class that runs items by blocks on every core and merges their sums in a fixed order.
+*/
+class CBlockRunner
+{
+    public :
+
+        // Initialize a runner of Count items, on ThreadCount threads, 0 for one per core.
+        CBlockRunner (unsigned long long Count, unsigned ThreadCount);
+
+        // Return the number of items.
+        unsigned long long GetCount () const;
+
+        // Return the number of items of the pilot.
+        unsigned GetPilotCount () const;
+
+        // Return the item of the pilot Pilot.
+        unsigned long long GetPilotItem (unsigned Pilot) const;
+
+        // Return the place of an item in the pilot, NO_PILOT if it is not in it.
+        unsigned FindPilot (unsigned long long Item) const;
+
+        // Call Body (Pilot, Item) for every item of the pilot on the job system, and return once they are done.
+        void RunPilot (const std::function <void (unsigned, unsigned long long)> &Body);
+
+        // Run every item, round after round. Block (Slot, Begin, End) sums up the items from Begin to End excluded in the
+        // accumulator Slot of the round, on a single job. Merge (Slot) then adds the accumulator to the total on the calling
+        // thread, in the order of the blocks, and Round (), unless it is empty, is called at the end of each round.
+        void RunBlocks (const std::function <void (unsigned, unsigned long long, unsigned long long)> &Block,
+                        const std::function <void (unsigned)> &Merge, const std::function <void ()> &Round = std::function <void ()> ());
+
+    private :
+
+        // Number of items and of items of the pilot.
+        unsigned long long m_Count;
+        unsigned m_PilotCount;
+
+        // Job system running the pilot and the blocks.
+        CJobSystem m_Jobs;
+};
+#endif // __CBLOCKRUNNER_H__
@@ -0,0 +1,420 @@
+/**
+ *
+ * @file CContactSolver.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CContactSolver source file.
+ *
+ * @details Contain the implementation of the class CContactSolver.
+ *
+ * @see CContactSolver.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <utility>      // std::pair
+#include <algorithm>    // std::sort, std::lower_bound, std::min, std::max
+#include <thread>       // std::thread::hardware_concurrency
+#include <math.h>       // sqrt
+
+#include "CContactSolver.h" // Class header
+#include "physics.h"        // ClampComputing
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Island of the bodies without contact.
+    const unsigned NoIsland = 0xFFFFFFFFu;
+
+    // Overlap left between two balls, as a part of the diameter, so that a contact lasts from one step to the next.
+    const float SlopRatio = 0.01f;
+
+    // Part of the remaining overlap removed at each pass on the positions, and number of passes.
+    const float PositionCorrection = 0.8f;
+    const unsigned PositionIterations = 4;
+
+    // Under this number of contacts for each list of islands, running a job costs more than it saves.
+    const unsigned MinContactsPerList = 256;
+
+    // Compare the islands by decreasing number of contacts.
+    struct LargerIsland
+    {
+        const vector <unsigned> *ContactStart;
+
+        bool operator () (unsigned A, unsigned B) const
+        {
+            return (*ContactStart) [A + 1] - (*ContactStart) [A] > (*ContactStart) [B + 1] - (*ContactStart) [B];
+        }
+    };
+}
+
+// Initialize a solver without contacts, with one thread per core.
+CContactSolver::CContactSolver () : m_Iterations (10), m_ThreadCount (1), m_Friction (0.5), m_Jobs (0), m_PosX (0), m_PosY (0), m_VelX (0), m_VelY (0), m_Radius (0)
+{
+    SetThreadCount (0);
+
+}// CContactSolver ()
+
+// Set the number of passes over the contacts of each step.
+void CContactSolver::SetIterations (unsigned Iterations)
+{
+    m_Iterations = Iterations;
+
+}// SetIterations ()
+
+// Set the maximum number of threads solving the islands, 0 for one per core.
+void CContactSolver::SetThreadCount (unsigned ThreadCount)
+{
+    // The number of cores may be unknown.
+    if (ThreadCount == 0)
+        ThreadCount = thread::hardware_concurrency ();
+
+    m_ThreadCount = max (ThreadCount, 1u);
+
+}// SetThreadCount ()
+
+// Set the job system solving the islands, 0 to solve them on the calling thread.
+void CContactSolver::SetJobSystem (CJobSystem *Jobs)
+{
+    m_Jobs = Jobs;
+
+}// SetJobSystem ()
+
+// Set the friction coefficient of the contacts.
+void CContactSolver::SetFriction (float Friction)
+{
+    m_Friction = Friction;
+
+}// SetFriction ()
+
+// Return the number of passes over the contacts.
+unsigned CContactSolver::GetIterations () const
+{
+    return m_Iterations;
+
+}// GetIterations ()
+
+// Return the maximum number of threads.
+unsigned CContactSolver::GetThreadCount () const
+{
+    return m_ThreadCount;
+
+}// GetThreadCount ()
+
+// Return the friction coefficient of the contacts.
+float CContactSolver::GetFriction () const
+{
+    return m_Friction;
+
+}// GetFriction ()
+
+// Forget the impulses of the previous steps.
+void CContactSolver::Clear ()
+{
+    m_Contacts.clear ();
+    m_Sorted.clear ();
+    m_Previous.clear ();
+    m_ContactStart.clear ();
+    m_BodyStart.clear ();
+    m_Bodies.clear ();
+
+}// Clear ()
+
+// Remove the contacts of the previous step, their impulses are kept to start the next solve from them.
+void CContactSolver::Begin (unsigned BodyCount)
+{
+    m_Contacts.clear ();
+
+    m_Parent.resize (BodyCount);
+    for (unsigned i = 0; i < BodyCount; ++i)
+        m_Parent [i] = i;
+
+}// Begin ()
+
+// Add a contact of the body A with B, or with the arena if B is CONTACT_ARENA.
+void CContactSolver::AddContact (unsigned A, unsigned B, float InvMassB, float NX, float NY, unsigned long long Key, float TargetSpeed)
+{
+    Contact New = {A, B, InvMassB, NX, NY, TargetSpeed, 0, 0, Key};
+
+    // Warm starting : a contact already there at the previous step starts with the same impulses.
+    Impulses Searched = {Key, 0, 0};
+    vector <Impulses>::const_iterator Found = lower_bound (m_Previous.begin (), m_Previous.end (), Searched);
+    if (Found != m_Previous.end () && Found->Key == Key)
+    {
+        New.Impulse = Found->Impulse;
+        New.Friction = Found->Friction;
+    }
+
+    m_Contacts.push_back (New);
+
+    // Two moving balls in contact are in the same island.
+    if (B != CONTACT_ARENA && InvMassB > 0)
+    {
+        unsigned RootA = FindRoot (A);
+        unsigned RootB = FindRoot (B);
+
+        // The smallest body is the root, the islands do not depend on the order of the contacts.
+        if (RootA < RootB)
+            m_Parent [RootB] = RootA;
+        else if (RootB < RootA)
+            m_Parent [RootA] = RootB;
+    }
+
+}// AddContact ()
+
+// Return the root of the island of a body, the path is shortened on the way.
+unsigned CContactSolver::FindRoot (unsigned Body)
+{
+    while (m_Parent [Body] != Body)
+    {
+        m_Parent [Body] = m_Parent [m_Parent [Body]];
+        Body = m_Parent [Body];
+    }
+
+    return Body;
+
+}// FindRoot ()
+
+// Sort the contacts and the bodies by islands.
+void CContactSolver::BuildIslands (unsigned BodyCount)
+{
+    // Number the islands in the order of their first contact.
+    m_RootIsland.assign (BodyCount, NoIsland);
+    unsigned IslandNumber = 0;
+    for (unsigned i = 0; i < m_Contacts.size (); ++i)
+    {
+        unsigned Root = FindRoot (m_Contacts [i].A);
+        if (m_RootIsland [Root] == NoIsland)
+            m_RootIsland [Root] = IslandNumber++;
+    }
+
+    // Counting sort of the contacts, as the points of CGrid.
+    m_ContactStart.assign (IslandNumber + 1, 0);
+    for (unsigned i = 0; i < m_Contacts.size (); ++i)
+        ++m_ContactStart [m_RootIsland [FindRoot (m_Contacts [i].A)] + 1];
+
+    for (unsigned i = 0; i < IslandNumber; ++i)
+        m_ContactStart [i + 1] += m_ContactStart [i];
+
+    m_Sorted.resize (m_Contacts.size ());
+    for (unsigned i = 0; i < m_Contacts.size (); ++i)
+        m_Sorted [m_ContactStart [m_RootIsland [FindRoot (m_Contacts [i].A)]]++] = m_Contacts [i];
+
+    for (unsigned i = IslandNumber; i > 0; --i)
+        m_ContactStart [i] = m_ContactStart [i - 1];
+    m_ContactStart [0] = 0;
+
+    // Same for the bodies, a body without contact is the root of no island.
+    m_BodyStart.assign (IslandNumber + 1, 0);
+    for (unsigned Body = 0; Body < BodyCount; ++Body)
+    {
+        unsigned Island = m_RootIsland [FindRoot (Body)];
+        if (Island != NoIsland)
+            ++m_BodyStart [Island + 1];
+    }
+
+    for (unsigned i = 0; i < IslandNumber; ++i)
+        m_BodyStart [i + 1] += m_BodyStart [i];
+
+    m_Bodies.resize (m_BodyStart [IslandNumber]);
+    for (unsigned Body = 0; Body < BodyCount; ++Body)
+    {
+        unsigned Island = m_RootIsland [FindRoot (Body)];
+        if (Island != NoIsland)
+            m_Bodies [m_BodyStart [Island]++] = Body;
+    }
+
+    for (unsigned i = IslandNumber; i > 0; --i)
+        m_BodyStart [i] = m_BodyStart [i - 1];
+    m_BodyStart [0] = 0;
+
+}// BuildIslands ()
+
+// Solve the velocities and move the balls of Radius apart.
+void CContactSolver::Solve (float *PosX, float *PosY, float *VelX, float *VelY, float Radius)
+{
+    m_PosX = PosX;
+    m_PosY = PosY;
+    m_VelX = VelX;
+    m_VelY = VelY;
+    m_Radius = Radius;
+
+    BuildIslands (m_Parent.size ());
+    unsigned IslandNumber = GetIslandCount ();
+
+    // The largest islands are given first, each one to the list with the fewest contacts : one list for each thread of
+    // the job system, at most m_ThreadCount.
+    unsigned ThreadNumber = m_Jobs != 0 ? min (m_ThreadCount, m_Jobs->GetThreadCount ()) : 1;
+    unsigned ListNumber = min (min (ThreadNumber, max (1u, (unsigned) m_Sorted.size () / MinContactsPerList)), max (IslandNumber, 1u));
+
+    vector <unsigned> Order (IslandNumber);
+    for (unsigned i = 0; i < IslandNumber; ++i)
+        Order [i] = i;
+    LargerIsland Larger = {&m_ContactStart};
+    stable_sort (Order.begin (), Order.end (), Larger);
+
+    m_IslandLists.resize (ListNumber);
+    vector <unsigned> Load (ListNumber, 0);
+    for (unsigned i = 0; i < ListNumber; ++i)
+        m_IslandLists [i].clear ();
+
+    for (unsigned i = 0; i < IslandNumber; ++i)
+    {
+        unsigned List = min_element (Load.begin (), Load.end ()) - Load.begin ();
+        m_IslandLists [List].push_back (Order [i]);
+        Load [List] += m_ContactStart [Order [i] + 1] - m_ContactStart [Order [i]];
+    }
+
+    // The islands share no moving body, the jobs write to different balls.
+    if (ListNumber > 1)
+    {
+        m_Jobs->ParallelFor (0, ListNumber, 1, [this] (unsigned FirstList, unsigned LastList)
+        {
+            for (unsigned List = FirstList; List < LastList; ++List)
+                SolveIslands (List);
+        });
+    }
+    else
+        SolveIslands (0);
+
+    // Keep the impulses for the next step.
+    m_Previous.resize (m_Sorted.size ());
+    for (unsigned i = 0; i < m_Sorted.size (); ++i)
+    {
+        m_Previous [i].Key = m_Sorted [i].Key;
+        m_Previous [i].Impulse = m_Sorted [i].Impulse;
+        m_Previous [i].Friction = m_Sorted [i].Friction;
+    }
+    sort (m_Previous.begin (), m_Previous.end ());
+
+}// Solve ()
+
+// Solve the islands of a list.
+void CContactSolver::SolveIslands (unsigned List)
+{
+    const vector <unsigned> &Islands = m_IslandLists [List];
+
+    for (unsigned i = 0; i < Islands.size (); ++i)
+        SolveIsland (Islands [i]);
+
+}// SolveIslands ()
+
+// Solve the contacts of an island.
+void CContactSolver::SolveIsland (unsigned Island)
+{
+    Contact *Begin = m_Sorted.data () + m_ContactStart [Island];
+    Contact *End = m_Sorted.data () + m_ContactStart [Island + 1];
+
+    /* WARM STARTING, the impulses of the previous step are given again */
+    for (Contact *Current = Begin; Current != End; ++Current)
+        Apply (*Current, Current->Impulse, Current->Friction);
+
+    /* SEQUENTIAL IMPULSES, the accumulated normal impulse only pushes, the friction is bounded by it */
+    for (unsigned Iteration = 0; Iteration < m_Iterations; ++Iteration)
+        for (Contact *Current = Begin; Current != End; ++Current)
+        {
+            float RelativeX = (Current->InvMassB > 0 ? m_VelX [Current->B] : 0) - m_VelX [Current->A];
+            float RelativeY = (Current->InvMassB > 0 ? m_VelY [Current->B] : 0) - m_VelY [Current->A];
+            float Normal = RelativeX * Current->NX + RelativeY * Current->NY;
+            float Tangent = RelativeY * Current->NX - RelativeX * Current->NY;
+
+            float Impulse = max (Current->Impulse + (Current->TargetSpeed - Normal) / (1 + Current->InvMassB), 0.0f);
+            float Bound = m_Friction * Impulse;
+            float Friction = min (max (Current->Friction - Tangent / (1 + Current->InvMassB), -Bound), Bound);
+
+            Apply (*Current, Impulse - Current->Impulse, Friction - Current->Friction);
+            Current->Impulse = Impulse;
+            Current->Friction = Friction;
+        }
+
+    /* POSITIONS, a part of the overlap is removed without changing the velocities */
+    float Diameter = 2 * m_Radius;
+    float Slop = SlopRatio * Diameter;
+
+    for (unsigned Iteration = 0; Iteration < PositionIterations; ++Iteration)
+        for (Contact *Current = Begin; Current != End; ++Current)
+        {
+            // The balls are kept inside the arena by the clamp.
+            if (Current->B == CONTACT_ARENA)
+                continue;
+
+            float DX = m_PosX [Current->B] - m_PosX [Current->A];
+            float DY = m_PosY [Current->B] - m_PosY [Current->A];
+            float Distance = sqrt (DX * DX + DY * DY);
+            float Overlap = Diameter - Distance;
+
+            if (Overlap <= Slop)
+                continue;
+
+            float NX = Current->NX;
+            float NY = Current->NY;
+            if (Distance > 0)
+            {
+                NX = DX / Distance;
+                NY = DY / Distance;
+            }
+
+            float Correction = PositionCorrection * (Overlap - Slop) / (1 + Current->InvMassB);
+
+            pair <float, float> A = ClampComputing (make_pair (m_PosX [Current->A] - NX * Correction, m_PosY [Current->A] - NY * Correction));
+            m_PosX [Current->A] = A.first;
+            m_PosY [Current->A] = A.second;
+
+            if (Current->InvMassB > 0)
+            {
+                pair <float, float> B = ClampComputing (make_pair (m_PosX [Current->B] + NX * Correction * Current->InvMassB,
+                                                                   m_PosY [Current->B] + NY * Correction * Current->InvMassB));
+                m_PosX [Current->B] = B.first;
+                m_PosY [Current->B] = B.second;
+            }
+        }
+
+}// SolveIsland ()
+
+// Give the impulse Normal * N + Tangent * T to B and its opposite to A.
+void CContactSolver::Apply (const Contact &Current, float Normal, float Tangent)
+{
+    float ImpulseX = Normal * Current.NX - Tangent * Current.NY;
+    float ImpulseY = Normal * Current.NY + Tangent * Current.NX;
+
+    m_VelX [Current.A] -= ImpulseX;
+    m_VelY [Current.A] -= ImpulseY;
+
+    if (Current.InvMassB > 0)
+    {
+        m_VelX [Current.B] += ImpulseX * Current.InvMassB;
+        m_VelY [Current.B] += ImpulseY * Current.InvMassB;
+    }
+
+}// Apply ()
+
+// Return the number of contacts of the last solve.
+unsigned CContactSolver::GetContactCount () const
+{
+    return m_Sorted.size ();
+
+}// GetContactCount ()
+
+// Return the number of islands of the last solve.
+unsigned CContactSolver::GetIslandCount () const
+{
+    return m_ContactStart.empty () ? 0 : m_ContactStart.size () - 1;
+
+}// GetIslandCount ()
+
+// Give the range of the bodies of an island.
+void CContactSolver::GetIsland (unsigned Island, const unsigned *&Begin, const unsigned *&End) const
+{
+    const unsigned *Bodies = m_Bodies.data ();
+
+    Begin = Bodies + m_BodyStart [Island];
+    End = Bodies + m_BodyStart [Island + 1];
+
+}// GetIsland ()
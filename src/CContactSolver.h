@@ -0,0 +1,162 @@
+/**
+ *
+ * @file CContactSolver.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CContactSolver header file.
+ *
+ * @details Contain declaration of the class CContactSolver, the solver of the contacts between the balls of a world.
+ *          The impulses of every contact are solved together by sequential impulses, starting from the impulses of the previous step.
+ *          The contacts are split into islands, the groups of balls touching each other, solved in parallel on a job system.
+ *
+ * @see CContactSolver.cpp
+ *
+ **/
+
+#ifndef __CCONTACTSOLVER_H__
+#define __CCONTACTSOLVER_H__
+
+#include <vector>       // std::vector
+
+#include "CJobSystem.h" // Job system
+
+// Other body of a contact with a wall, the floor or the roof.
+#define CONTACT_ARENA   0xFFFFFFFFu
+
+/*
+** CContactSolver class that computes the impulses keeping the balls in contact from going through each other.
+*/
+class CContactSolver
+{
+    public :
+
+        // Initialize a solver without contacts, with one thread per core.
+        CContactSolver ();
+
+        // Set the number of passes over the contacts of each step.
+        void SetIterations (unsigned Iterations);
+
+        // Set the maximum number of threads solving the islands, 0 for one per core.
+        void SetThreadCount (unsigned ThreadCount);
+
+        // Set the job system solving the islands, 0 to solve them on the calling thread. The job system is not copied.
+        void SetJobSystem (CJobSystem *Jobs);
+
+        // Set the friction coefficient of the contacts, the tangent impulse is at most Friction times the normal one.
+        void SetFriction (float Friction);
+
+        // Return the number of passes over the contacts.
+        unsigned GetIterations () const;
+
+        // Return the maximum number of threads.
+        unsigned GetThreadCount () const;
+
+        // Return the friction coefficient of the contacts.
+        float GetFriction () const;
+
+        // Forget the impulses of the previous steps.
+        void Clear ();
+
+        // Remove the contacts of the previous step, their impulses are kept to start the next solve from them.
+        void Begin (unsigned BodyCount);
+
+        // Add a contact of the body A with B, or with the arena if B is CONTACT_ARENA. A static B is not moved (InvMassB = 0).
+        // (NX, NY) goes from A to B, Key names the pair from one step to the next, the normal relative velocity must reach TargetSpeed.
+        void AddContact (unsigned A, unsigned B, float InvMassB, float NX, float NY, unsigned long long Key, float TargetSpeed);
+
+        // Solve the velocities and move the balls of Radius apart, the positions of the static bodies are only read.
+        void Solve (float *PosX, float *PosY, float *VelX, float *VelY, float Radius);
+
+        // Return the number of contacts and islands of the last solve.
+        unsigned GetContactCount () const;
+        unsigned GetIslandCount () const;
+
+        // Give the range of the bodies of an island.
+        void GetIsland (unsigned Island, const unsigned *&Begin, const unsigned *&End) const;
+
+    private :
+
+        // Store a contact.
+        struct Contact
+        {
+            unsigned A;                 // the first body.
+            unsigned B;                 // the second body or CONTACT_ARENA.
+            float InvMassB;             // the inverse mass of the second body, 0 if it is static.
+            float NX;                   // the normal going from A to B.
+            float NY;
+            float TargetSpeed;          // the normal relative velocity to reach.
+            float Impulse;              // the impulse accumulated along the normal.
+            float Friction;             // the impulse accumulated along the tangent (-NY, NX).
+            unsigned long long Key;     // the name of the pair.
+        };
+
+        // Store the impulses of a contact from one step to the next.
+        struct Impulses
+        {
+            unsigned long long Key;     // the name of the pair.
+            float Impulse;              // the normal impulse.
+            float Friction;             // the tangent impulse.
+
+            bool operator < (const Impulses &Other) const
+            {
+                return Key < Other.Key;
+            }
+        };
+
+        // Return the root of the island of a body, the path is shortened on the way.
+        unsigned FindRoot (unsigned Body);
+
+        // Sort the contacts and the bodies by islands.
+        void BuildIslands (unsigned BodyCount);
+
+        // Solve the islands of a list.
+        void SolveIslands (unsigned List);
+
+        // Solve the contacts of an island.
+        void SolveIsland (unsigned Island);
+
+        // Give the impulse Normal * N + Tangent * T to B and its opposite to A.
+        void Apply (const Contact &Current, float Normal, float Tangent);
+
+        // Number of passes over the contacts, maximum number of threads and friction coefficient.
+        unsigned m_Iterations;
+        unsigned m_ThreadCount;
+        float m_Friction;
+
+        // Job system solving the islands, 0 for none.
+        CJobSystem *m_Jobs;
+
+        // Contacts of the current step.
+        std::vector <Contact> m_Contacts;
+
+        // Impulses of the previous step, sorted by keys.
+        std::vector <Impulses> m_Previous;
+
+        // Parent of each body in the union-find of the islands.
+        std::vector <unsigned> m_Parent;
+
+        // Island of each root body.
+        std::vector <unsigned> m_RootIsland;
+
+        // Contacts and bodies sorted by islands, with the index of the first one of each island.
+        std::vector <Contact> m_Sorted;
+        std::vector <unsigned> m_ContactStart;
+        std::vector <unsigned> m_Bodies;
+        std::vector <unsigned> m_BodyStart;
+
+        // Lists of islands of about the same number of contacts, each one solved by a job.
+        std::vector <std::vector <unsigned> > m_IslandLists;
+
+        // Arrays of the bodies during a solve.
+        float *m_PosX;
+        float *m_PosY;
+        float *m_VelX;
+        float *m_VelY;
+        float m_Radius;
+};
+#endif // __CCONTACTSOLVER_H__
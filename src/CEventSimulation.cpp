@@ -0,0 +1,229 @@
+/**
+ *
+ * @file CEventSimulation.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CEventSimulation source file.
+ *
+ * @details Contain the implementation of the class CEventSimulation.
+ *
+ * @see CEventSimulation.h
+ *
+ **/
+
+#include <utility>      // std::pair
+#include <math.h>       // fabs
+
+#include "CEventSimulation.h"   // Class header
+#include "physics.h"            // Impact computing
+#include "fastmath.h"           // FastSinCos
+#include "common.h"             // Settings struct, COLLISION codes, SLIDE_FRICTION
+
+using namespace std;
+using namespace nsTools;
+
+// Initialize the simulation with the user parameters.
+CEventSimulation::CEventSimulation (const Settings &Parameters) : m_SaveSettings (Parameters)
+{
+    Reset ();
+
+}// CEventSimulation ()
+
+// Set back the simulation at its initial state.
+void CEventSimulation::Reset ()
+{
+    m_OriginX = 0;
+    m_OriginY = m_SaveSettings.InitPos;
+    float Sin;
+    float Cos;
+    FastSinCos (m_SaveSettings.Angle, Sin, Cos);
+
+    m_VelX = m_SaveSettings.Speed * Cos;
+    m_VelY = m_SaveSettings.Speed * Sin;
+    m_OriginTime = 0;
+    m_Time = 0;
+    m_LastImpact = 0;
+    m_Gravity = m_SaveSettings.Gravity;
+    m_RestitutionCoef = m_SaveSettings.RestitutionCoef;
+    m_Friction = 0;
+    m_BounceCount = 0;
+    m_Stopped = false;
+
+    ScheduleImpact ();
+
+}// Reset ()
+
+// Compute the next impact of the current trajectory, or the time the ball sliding on the floor stops.
+void CEventSimulation::ScheduleImpact ()
+{
+    double Delay = ImpactComputing (m_OriginX, m_OriginY, m_VelX, m_VelY, m_Gravity, m_ImpactCode, m_Friction);
+
+    // The friction stops the ball before the next wall, the event touches no surface.
+    if (m_Friction != 0 && (Delay < 0 || m_VelX / m_Friction < Delay))
+    {
+        Delay = m_VelX / m_Friction;
+        m_ImpactCode = 0;
+    }
+
+    m_ImpactTime = Delay < 0 ? -1 : m_OriginTime + Delay;
+
+}// ScheduleImpact ()
+
+// Move the ball to the next impact and compute its new trajectory.
+void CEventSimulation::Bounce ()
+{
+    // Position and velocity just before the impact.
+    double Time = m_ImpactTime - m_OriginTime;
+    double X = m_OriginX + m_VelX * Time - 0.5 * m_Friction * Time * Time;
+    double Y = m_OriginY + m_VelY * Time - 0.5 * m_Gravity * Time * Time;
+    double VelX = m_ImpactCode == 0 ? 0 : m_VelX - m_Friction * Time;
+    double VelY = m_VelY - m_Gravity * Time;
+
+    // Put the ball exactly on the touched surfaces and reflect the normal component of the velocity, scaled by the coefficient.
+    if (m_ImpactCode & COLLISION_LEFT)
+    {
+        X = 0;
+        VelX = fabs (VelX) * m_RestitutionCoef;
+        ++m_BounceCount;
+    }
+    if (m_ImpactCode & COLLISION_RIGHT)
+    {
+        X = ARENA_WIDTH;
+        VelX = -fabs (VelX) * m_RestitutionCoef;
+        ++m_BounceCount;
+    }
+    if (m_ImpactCode & COLLISION_BOTTOM)
+    {
+        Y = 0;
+        VelY = fabs (VelY) * m_RestitutionCoef;
+        ++m_BounceCount;
+    }
+    if (m_ImpactCode & COLLISION_TOP)
+    {
+        Y = ARENA_HEIGHT;
+        VelY = -fabs (VelY) * m_RestitutionCoef;
+        ++m_BounceCount;
+    }
+
+    // The bounces on the floor became too small, the rest of the series is summed and the ball now slides on it.
+    unsigned Bounces;
+    if ((m_ImpactCode & COLLISION_BOTTOM) && RestComputing (VelY, m_Gravity, m_RestitutionCoef, REST_FLIGHT_TIME, Bounces) >= 0)
+    {
+        m_BounceCount += Bounces;
+        VelY = 0;
+        m_Gravity = 0;
+    }
+
+    // Start the new trajectory.
+    m_OriginX = X;
+    m_OriginY = Y;
+    m_VelX = VelX;
+    m_VelY = VelY;
+    m_OriginTime = m_ImpactTime;
+    m_Time = m_ImpactTime;
+    m_LastImpact = m_ImpactCode;
+
+    // As in CSimulation, the ball sliding on the floor is slowed down by the friction.
+    m_Friction = 0;
+    if (m_Gravity == 0 && Y == 0 && VelX != 0 && m_SaveSettings.Gravity > 0)
+        m_Friction = (VelX > 0 ? 1 : -1) * SLIDE_FRICTION * m_SaveSettings.Gravity;
+
+    // Same stop condition as CSimulation, the ball lies on the floor.
+    if (m_Gravity == 0 && Y == 0 && fabs (VelX) < REST_SPEED)
+    {
+        m_VelX = 0;
+        m_VelY = 0;
+        m_Stopped = true;
+        m_ImpactTime = -1;
+        m_ImpactCode = 0;
+    }
+    else
+        ScheduleImpact ();
+
+}// Bounce ()
+
+// Advance the simulation to the next impact and bounce, return the time of the impact.
+double CEventSimulation::NextEvent ()
+{
+    if (m_Stopped || m_ImpactTime < 0)
+        return -1;
+
+    Bounce ();
+
+    return m_Time;
+
+}// NextEvent ()
+
+// Advance the simulation to the time Time, processing every impact before.
+void CEventSimulation::AdvanceTo (double Time)
+{
+    while (! m_Stopped && m_ImpactTime >= 0 && m_ImpactTime <= Time)
+        Bounce ();
+
+    if (Time > m_Time)
+        m_Time = Time;
+
+}// AdvanceTo ()
+
+// Tells if the ball stopped.
+bool CEventSimulation::IsStopped () const
+{
+    return m_Stopped;
+
+}// IsStopped ()
+
+// Return the time elapsed since the beginning of the simulation.
+double CEventSimulation::GetTime () const
+{
+    return m_Time;
+
+}// GetTime ()
+
+// Return the time of the next impact.
+double CEventSimulation::GetNextEventTime () const
+{
+    return m_Stopped ? -1 : m_ImpactTime;
+
+}// GetNextEventTime ()
+
+// Return the current position of the ball.
+pair <float, float> CEventSimulation::GetPosition () const
+{
+    // A stopped ball does not fall anymore.
+    if (m_Stopped)
+        return make_pair ((float) m_OriginX, (float) m_OriginY);
+
+    double Time = m_Time - m_OriginTime;
+
+    return make_pair ((float) (m_OriginX + m_VelX * Time - 0.5 * m_Friction * Time * Time), (float) (m_OriginY + m_VelY * Time - 0.5 * m_Gravity * Time * Time));
+
+}// GetPosition ()
+
+// Return the current velocity of the ball.
+pair <float, float> CEventSimulation::GetVelocity () const
+{
+    if (m_Stopped)
+        return make_pair (0.0f, 0.0f);
+
+    return make_pair ((float) (m_VelX - m_Friction * (m_Time - m_OriginTime)), (float) (m_VelY - m_Gravity * (m_Time - m_OriginTime)));
+
+}// GetVelocity ()
+
+// Return the number of bounces since the beginning.
+unsigned CEventSimulation::GetBounceCount () const
+{
+    return m_BounceCount;
+
+}// GetBounceCount ()
+
+// Return the surfaces touched by the last impact.
+unsigned CEventSimulation::GetLastImpact () const
+{
+    return m_LastImpact;
+
+}// GetLastImpact ()
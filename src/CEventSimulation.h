@@ -0,0 +1,112 @@
+/**
+ *
+ * @file CEventSimulation.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CEventSimulation header file.
+ *
+ * @details Contain declaration of the class CEventSimulation, the event driven simulation engine.
+ *          Every trajectory is an exact parabola, so the time of the next impact is computed in closed
+ *          form and the ball jumps directly from one bounce to the next one.
+ *
+ * @see CEventSimulation.cpp
+ *
+ **/
+
+#ifndef __CEVENTSIMULATION_H__
+#define __CEVENTSIMULATION_H__
+
+#include <utility>      // std::pair
+
+#include "common.h"     // Settings struct
+
+/*
+** CEventSimulation class that computes the trajectory of the ball, one bounce after the other.
+** The state is kept in double precision as the time is accumulated over thousands of events.
+*/
+class CEventSimulation
+{
+    public :
+
+        // Initialize the simulation with the user parameters.
+        CEventSimulation (const nsTools::Settings &Parameters);
+
+        // Set back the simulation at its initial state.
+        void Reset ();
+
+        // Advance the simulation to the next impact and bounce, return the time of the impact (negative if the ball stopped).
+        double NextEvent ();
+
+        // Advance the simulation to the time Time, processing every impact before.
+        void AdvanceTo (double Time);
+
+        // Tells if the ball stopped.
+        bool IsStopped () const;
+
+        // Return the time elapsed since the beginning of the simulation.
+        double GetTime () const;
+
+        // Return the time of the next impact (negative if the ball stopped or never touches anything).
+        double GetNextEventTime () const;
+
+        // Return the current position of the ball.
+        std::pair <float, float> GetPosition () const;
+
+        // Return the current velocity of the ball.
+        std::pair <float, float> GetVelocity () const;
+
+        // Return the number of bounces since the beginning.
+        unsigned GetBounceCount () const;
+
+        // Return the surfaces touched by the last impact (COLLISION codes).
+        unsigned GetLastImpact () const;
+
+    private :
+
+        // Compute the next impact of the current trajectory, or the time the ball sliding on the floor stops.
+        void ScheduleImpact ();
+
+        // Move the ball to the next impact and compute its new trajectory.
+        void Bounce ();
+
+        // Contain the settings to start again.
+        nsTools::Settings m_SaveSettings;
+
+        // Position and velocity at the beginning of the current trajectory.
+        double m_OriginX;
+        double m_OriginY;
+        double m_VelX;
+        double m_VelY;
+
+        // Time of the beginning of the current trajectory.
+        double m_OriginTime;
+
+        // Time elapsed since the beginning of the simulation.
+        double m_Time;
+
+        // Time and surfaces of the next impact.
+        double m_ImpactTime;
+        unsigned m_ImpactCode;
+
+        // Surfaces of the last impact.
+        unsigned m_LastImpact;
+
+        // Gravity (0 once the ball slides on the floor) and coefficient of restitution.
+        double m_Gravity;
+        double m_RestitutionCoef;
+
+        // Deceleration of the ball sliding on the floor, against its velocity (0 while it flies).
+        double m_Friction;
+
+        // Number of bounces since the beginning.
+        unsigned m_BounceCount;
+
+        // Tells if the ball stopped.
+        bool m_Stopped;
+};
+#endif // __CEVENTSIMULATION_H__
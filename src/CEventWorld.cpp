@@ -0,0 +1,642 @@
+/**
+ *
+ * @file CEventWorld.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CEventWorld source file.
+ *
+ * @details Contain the implementation of the class CEventWorld.
+ *
+ * @see CEventWorld.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <utility>      // std::pair
+#include <algorithm>    // std::push_heap, std::pop_heap, std::make_heap, std::min, std::max
+#include <limits>       // std::numeric_limits
+#include <math.h>       // sqrt, fabs, floor
+
+#include "CEventWorld.h"    // Class header
+#include "physics.h"        // Impact, contact and rest computing
+#include "fastmath.h"       // FastSinCos
+#include "common.h"         // Settings struct, COLLISION codes, REST thresholds, SLIDE_FRICTION
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // No ball, for the empty cells and the events without a second ball.
+    const unsigned NoBall = numeric_limits <unsigned>::max ();
+
+    // Two balls colliding again this soon after a collision bounce without loss, else a ball caught between two
+    // others (or between a ball and the floor) would collide infinitely many times in a finite time (TC model).
+    const double CollapseTime = 0.00001;
+
+}// namespace
+
+// Initialize an empty world of balls of radius Radius.
+CEventWorld::CEventWorld (float Radius/* = 0*/) : m_Columns (1), m_Rows (1), m_CellWidth (ARENA_WIDTH),
+                                                  m_CellHeight (ARENA_HEIGHT), m_Radius (Radius), m_Now (0),
+                                                  m_Started (false), m_EventNumber (0), m_CollisionCount (0),
+                                                  m_StaleCount (0)
+{
+
+}// CEventWorld ()
+
+// Reserve memory for BallNumber balls.
+void CEventWorld::Reserve (unsigned BallNumber)
+{
+    m_X.reserve (BallNumber);
+    m_Y.reserve (BallNumber);
+    m_VelX.reserve (BallNumber);
+    m_VelY.reserve (BallNumber);
+    m_Time.reserve (BallNumber);
+    m_Gravity.reserve (BallNumber);
+    m_BallGravity.reserve (BallNumber);
+    m_Friction.reserve (BallNumber);
+    m_RestitutionCoef.reserve (BallNumber);
+    m_BounceCount.reserve (BallNumber);
+    m_EventCount.reserve (BallNumber);
+    m_LastCollision.reserve (BallNumber);
+    m_Resting.reserve (BallNumber);
+    m_Stopped.reserve (BallNumber);
+    m_Cell.reserve (BallNumber);
+    m_Next.reserve (BallNumber);
+    m_Previous.reserve (BallNumber);
+
+}// Reserve ()
+
+// Add a ball launched with the parameters from the abscissa X, return its index.
+unsigned CEventWorld::AddBall (const Settings &Parameters, float X/* = 0*/)
+{
+    float Sin;
+    float Cos;
+    FastSinCos (Parameters.Angle, Sin, Cos);
+
+    m_X.push_back (X);
+    m_Y.push_back (Parameters.InitPos);
+    m_VelX.push_back (Parameters.Speed * Cos);
+    m_VelY.push_back (Parameters.Speed * Sin);
+    m_Time.push_back (m_Now);
+    m_Gravity.push_back (Parameters.Gravity);
+    m_BallGravity.push_back (Parameters.Gravity);
+    m_Friction.push_back (0);
+    m_RestitutionCoef.push_back (Parameters.RestitutionCoef);
+    m_BounceCount.push_back (0);
+    m_EventCount.push_back (0);
+    m_LastCollision.push_back (-1);
+    m_Resting.push_back (false);
+    m_Stopped.push_back (false);
+    m_Cell.push_back (NoBall);
+    m_Next.push_back (NoBall);
+    m_Previous.push_back (NoBall);
+
+    return m_X.size () - 1;
+
+}// AddBall ()
+
+// Build the grid and compute the first events of every ball.
+void CEventWorld::Start ()
+{
+    m_Started = true;
+    unsigned BallNumber = m_X.size ();
+
+    // A cell is at least as large as a ball, so the balls in contact are in neighbour cells. The grid does not get more cells than balls.
+    if (m_Radius > 0)
+    {
+        double Size = max (2 * m_Radius, sqrt (ARENA_WIDTH * ARENA_HEIGHT / (double) max (BallNumber, 1u)));
+        m_Columns = max (1u, (unsigned) floor (ARENA_WIDTH / Size));
+        m_Rows = max (1u, (unsigned) floor (ARENA_HEIGHT / Size));
+    }
+    m_CellWidth = (double) ARENA_WIDTH / m_Columns;
+    m_CellHeight = (double) ARENA_HEIGHT / m_Rows;
+    m_CellHead.assign (m_Columns * m_Rows, NoBall);
+
+    for (unsigned Ball = 0; Ball < BallNumber; ++Ball)
+        MoveToCell (Ball, GetCell (m_X [Ball], m_Y [Ball]));
+
+    for (unsigned Ball = 0; Ball < BallNumber; ++Ball)
+        Predict (Ball);
+
+}// Start ()
+
+// Return the cell of a point.
+unsigned CEventWorld::GetCell (double X, double Y) const
+{
+    unsigned Column = X <= 0 ? 0 : min (m_Columns - 1, (unsigned) (X / m_CellWidth));
+    unsigned Row = Y <= 0 ? 0 : min (m_Rows - 1, (unsigned) (Y / m_CellHeight));
+
+    return Row * m_Columns + Column;
+
+}// GetCell ()
+
+// Move a ball to a cell.
+void CEventWorld::MoveToCell (unsigned Ball, unsigned Cell)
+{
+    // Unlink it from its current cell.
+    if (m_Cell [Ball] != NoBall)
+    {
+        if (m_Previous [Ball] != NoBall)
+            m_Next [m_Previous [Ball]] = m_Next [Ball];
+        else
+            m_CellHead [m_Cell [Ball]] = m_Next [Ball];
+
+        if (m_Next [Ball] != NoBall)
+            m_Previous [m_Next [Ball]] = m_Previous [Ball];
+    }
+
+    // Put it first in the new one.
+    m_Cell [Ball] = Cell;
+    m_Previous [Ball] = NoBall;
+    m_Next [Ball] = m_CellHead [Cell];
+    if (m_CellHead [Cell] != NoBall)
+        m_Previous [m_CellHead [Cell]] = Ball;
+    m_CellHead [Cell] = Ball;
+
+}// MoveToCell ()
+
+// Give the state of a ball at the time Time.
+void CEventWorld::StateAt (unsigned Ball, double Time, double &X, double &Y, double &VelX, double &VelY) const
+{
+    double Elapsed = Time - m_Time [Ball];
+
+    // The slide on the floor ends with an event before the friction would send the ball back.
+    X = m_X [Ball] + m_VelX [Ball] * Elapsed - 0.5 * m_Friction [Ball] * Elapsed * Elapsed;
+    Y = m_Y [Ball] + m_VelY [Ball] * Elapsed - 0.5 * m_Gravity [Ball] * Elapsed * Elapsed;
+    VelX = m_VelX [Ball] - m_Friction [Ball] * Elapsed;
+    VelY = m_VelY [Ball] - m_Gravity [Ball] * Elapsed;
+
+}// StateAt ()
+
+// Move the state of a ball to the current time.
+void CEventWorld::Update (unsigned Ball)
+{
+    StateAt (Ball, m_Now, m_X [Ball], m_Y [Ball], m_VelX [Ball], m_VelY [Ball]);
+    m_Time [Ball] = m_Now;
+
+}// Update ()
+
+// Add an event to the heap.
+void CEventWorld::Schedule (EventType Type, double Time, unsigned Ball, unsigned Other, unsigned Code)
+{
+    Event New = {Time, Type, Ball, Other, Code, m_EventCount [Ball], Other != NoBall ? m_EventCount [Other] : 0};
+
+    m_Events.push_back (New);
+    push_heap (m_Events.begin (), m_Events.end (), EventLater ());
+
+}// Schedule ()
+
+// Tells if an event is still up to date.
+bool CEventWorld::IsValid (const Event &Current) const
+{
+    return Current.Count == m_EventCount [Current.Ball] && (Current.Other == NoBall || Current.OtherCount == m_EventCount [Current.Other]);
+
+}// IsValid ()
+
+// Remove the out of date events from the heap.
+void CEventWorld::Compact ()
+{
+    unsigned Kept = 0;
+    for (unsigned i = 0; i < m_Events.size (); ++i)
+        if (IsValid (m_Events [i]))
+            m_Events [Kept++] = m_Events [i];
+
+    m_StaleCount += m_Events.size () - Kept;
+    m_Events.resize (Kept);
+    make_heap (m_Events.begin (), m_Events.end (), EventLater ());
+
+}// Compact ()
+
+// Compute the next event of a ball.
+void CEventWorld::Predict (unsigned Ball)
+{
+    // Only the first event is kept, the heap holds about one event per ball.
+    double Best = -1;
+    EventType BestType = EVENT_WALL;
+    unsigned BestOther = NoBall;
+    unsigned BestCode = 0;
+
+    double X = m_X [Ball];
+    double Y = m_Y [Ball];
+    double VelX = m_VelX [Ball];
+    double VelY = m_VelY [Ball];
+    double Gravity = m_Gravity [Ball];
+    double Friction = m_Friction [Ball];
+
+    unsigned Column = m_Cell [Ball] % m_Columns;
+    unsigned Row = m_Cell [Ball] / m_Columns;
+
+    if (! m_Stopped [Ball])
+    {
+        /* WALLS, FLOOR AND ROOF */
+        unsigned Code;
+        double Delay = ImpactComputing (X, Y, VelX, VelY, Gravity, Code, Friction);
+        if (Delay >= 0)
+        {
+            Best = Delay;
+            BestCode = Code;
+        }
+
+        /* END OF THE SLIDE */
+        if (Friction != 0 && (Best < 0 || VelX / Friction < Best))
+        {
+            Best = VelX / Friction;
+            BestType = EVENT_STOP;
+        }
+
+        /* CELL CHANGE, the sides of the cell on the arena are walls */
+        double First = -1;
+        unsigned Cell = 0;
+        double Times [4] = {Column > 0 ? CrossingComputing (-0.5 * Friction, VelX, X - Column * m_CellWidth, false) : -1,
+                            Column + 1 < m_Columns ? CrossingComputing (-0.5 * Friction, VelX, X - (Column + 1) * m_CellWidth, true) : -1,
+                            Row > 0 ? CrossingComputing (-0.5 * Gravity, VelY, Y - Row * m_CellHeight, false) : -1,
+                            Row + 1 < m_Rows ? CrossingComputing (-0.5 * Gravity, VelY, Y - (Row + 1) * m_CellHeight, true) : -1};
+        const unsigned Cells [4] = {m_Cell [Ball] - 1, m_Cell [Ball] + 1, m_Cell [Ball] - m_Columns, m_Cell [Ball] + m_Columns};
+
+        for (unsigned i = 0; i < 4; ++i)
+            if (Times [i] >= 0 && (First < 0 || Times [i] < First))
+            {
+                First = Times [i];
+                Cell = Cells [i];
+            }
+
+        if (First >= 0 && (Best < 0 || First < Best))
+        {
+            Best = First;
+            BestType = EVENT_CELL;
+            BestCode = Cell;
+        }
+    }
+
+    /* CONTACTS WITH THE BALLS OF THE NEIGHBOUR CELLS */
+    if (m_Radius > 0)
+    {
+
+        unsigned FirstColumn = Column > 0 ? Column - 1 : 0;
+        unsigned LastColumn = min (Column + 1, m_Columns - 1);
+        unsigned FirstRow = Row > 0 ? Row - 1 : 0;
+        unsigned LastRow = min (Row + 1, m_Rows - 1);
+
+        for (unsigned j = FirstRow; j <= LastRow; ++j)
+            for (unsigned i = FirstColumn; i <= LastColumn; ++i)
+                for (unsigned Other = m_CellHead [j * m_Columns + i]; Other != NoBall; Other = m_Next [Other])
+                {
+                    // Two stopped balls will not meet.
+                    if (Other == Ball || (m_Stopped [Ball] && m_Stopped [Other]))
+                        continue;
+
+                    double OtherX;
+                    double OtherY;
+                    double OtherVelX;
+                    double OtherVelY;
+                    StateAt (Other, m_Now, OtherX, OtherY, OtherVelX, OtherVelY);
+
+                    double Delay = ContactComputing (OtherX - X, OtherY - Y, OtherVelX - VelX, OtherVelY - VelY,
+                                                     Friction - m_Friction [Other], Gravity - m_Gravity [Other], 2 * m_Radius);
+                    if (Delay >= 0 && (Best < 0 || Delay < Best))
+                    {
+                        Best = Delay;
+                        BestType = EVENT_BALL;
+                        BestOther = Other;
+                    }
+                }
+    }
+
+    if (Best >= 0)
+        Schedule (BestType, m_Now + Best, Ball, BestOther, BestCode);
+
+}// Predict ()
+
+// Start a new flight of a ball with a new velocity, a ball lying on the floor stays on it unless thrown upward.
+void CEventWorld::Launch (unsigned Ball, double VelX, double VelY)
+{
+    m_VelX [Ball] = VelX;
+
+    if (m_Resting [Ball] && m_Y [Ball] <= 0 && VelY <= 0)
+        m_VelY [Ball] = 0;
+    else
+    {
+        m_VelY [Ball] = VelY;
+        m_Gravity [Ball] = m_BallGravity [Ball];
+        m_Resting [Ball] = false;
+    }
+
+    // Same stop condition as CEventSimulation, the ball lies on the floor or on a stopped ball.
+    m_Stopped [Ball] = m_Resting [Ball] && fabs (VelX) < REST_SPEED;
+    if (m_Stopped [Ball])
+        m_VelX [Ball] = 0;
+
+    // As in CSimulation, the ball sliding on the floor is slowed down by the friction until it stops.
+    m_Friction [Ball] = 0;
+    if (m_Resting [Ball] && m_Y [Ball] <= 0 && ! m_Stopped [Ball])
+        m_Friction [Ball] = (VelX > 0 ? 1 : -1) * SLIDE_FRICTION * m_BallGravity [Ball];
+
+}// Launch ()
+
+// Return the part of an impulse along (DirX, DirY) a ball takes, its inverse mass along this direction.
+double CEventWorld::GetMobility (unsigned Ball, double DirX, double DirY) const
+{
+    // Free ball, or pulled up from its support.
+    if (! m_Resting [Ball] || DirY >= 0)
+        return 1;
+
+    // The floor keeps it from going down, it only slides.
+    if (m_Y [Ball] <= 0)
+        return DirX * DirX;
+
+    // Stopped on other balls.
+    return 0;
+
+}// GetMobility ()
+
+// Give an impulse along (DirX, DirY) to a ball.
+void CEventWorld::Push (unsigned Ball, double Impulse, double DirX, double DirY)
+{
+    if (! m_Resting [Ball] || DirY >= 0)
+        Launch (Ball, m_VelX [Ball] + Impulse * DirX, m_VelY [Ball] + Impulse * DirY);
+    else if (m_Y [Ball] <= 0)
+        Launch (Ball, m_VelX [Ball] + Impulse * DirX, m_VelY [Ball]);
+
+}// Push ()
+
+// Make a ball bounce on the surfaces of Code.
+void CEventWorld::WallBounce (unsigned Ball, unsigned Code)
+{
+    double VelX = m_VelX [Ball];
+    double VelY = m_VelY [Ball];
+    double RestitutionCoef = m_RestitutionCoef [Ball];
+
+    // Put the ball exactly on the touched surfaces and reflect the normal component of the velocity, scaled by the coefficient.
+    if (Code & COLLISION_LEFT)
+    {
+        m_X [Ball] = 0;
+        VelX = fabs (VelX) * RestitutionCoef;
+        ++m_BounceCount [Ball];
+    }
+    if (Code & COLLISION_RIGHT)
+    {
+        m_X [Ball] = ARENA_WIDTH;
+        VelX = -fabs (VelX) * RestitutionCoef;
+        ++m_BounceCount [Ball];
+    }
+    if (Code & COLLISION_BOTTOM)
+    {
+        m_Y [Ball] = 0;
+        VelY = fabs (VelY) * RestitutionCoef;
+        ++m_BounceCount [Ball];
+    }
+    if (Code & COLLISION_TOP)
+    {
+        m_Y [Ball] = ARENA_HEIGHT;
+        VelY = -fabs (VelY) * RestitutionCoef;
+        ++m_BounceCount [Ball];
+    }
+
+    // The bounces on the floor became too small, the rest of the series is summed and the ball now slides on it.
+    unsigned Bounces;
+    if ((Code & COLLISION_BOTTOM) && RestComputing (VelY, m_Gravity [Ball], RestitutionCoef, REST_FLIGHT_TIME, Bounces) >= 0)
+    {
+        m_BounceCount [Ball] += Bounces;
+        m_Resting [Ball] = true;
+        m_Gravity [Ball] = 0;
+        VelY = 0;
+    }
+
+    Launch (Ball, VelX, VelY);
+
+}// WallBounce ()
+
+// Make two balls in contact bounce on each other.
+void CEventWorld::Collide (unsigned A, unsigned B)
+{
+    double DX = m_X [B] - m_X [A];
+    double DY = m_Y [B] - m_Y [A];
+    double Distance = sqrt (DX * DX + DY * DY);
+
+    if (Distance <= 0)
+        return;
+
+    double NX = DX / Distance;
+    double NY = DY / Distance;
+
+    double Approach = (m_VelX [B] - m_VelX [A]) * NX + (m_VelY [B] - m_VelY [A]) * NY;
+    if (Approach >= REST_SPEED)
+        return;
+
+    // A contact too slow to be told from the rounding errors is pushed apart, else it would be found again at once.
+    Approach = min (Approach, -REST_SPEED);
+
+    // The relative normal speed is reversed, scaled by the smallest coefficient.
+    double RestitutionCoef = min (m_RestitutionCoef [A], m_RestitutionCoef [B]);
+    if (m_Now - m_LastCollision [A] < CollapseTime || m_Now - m_LastCollision [B] < CollapseTime)
+        RestitutionCoef = 1;
+
+    // As a sleeping pile of CWorld, a stopped ball is only woken by a ball faster than the bounces too short to be followed,
+    // a slower ball sliding on the floor stops against it.
+    unsigned Moving = m_Stopped [A] ? B : A;
+    if (m_Stopped [A] != m_Stopped [B] && m_Resting [Moving] && -Approach < m_BallGravity [Moving] * REST_FLIGHT_TIME)
+    {
+        Launch (Moving, 0, 0);
+        m_LastCollision [A] = m_Now;
+        m_LastCollision [B] = m_Now;
+        ++m_CollisionCount;
+        return;
+    }
+
+    // Same mass for every ball, but the support of a resting ball takes the part of the impulse pushing it down.
+    double Mobility = GetMobility (A, -NX, -NY) + GetMobility (B, NX, NY);
+    if (Mobility <= 0)
+        return;
+
+    double Impulse = -(1 + RestitutionCoef) * Approach / Mobility;
+
+    unsigned Upper = NY > 0 ? B : A;
+    unsigned Lower = NY > 0 ? A : B;
+    bool Landing = ! m_Resting [Upper] && m_Resting [Lower];
+
+    Push (A, Impulse, -NX, -NY);
+    Push (B, Impulse, NX, NY);
+
+    m_LastCollision [A] = m_Now;
+    m_LastCollision [B] = m_Now;
+    ++m_CollisionCount;
+
+    // As on the floor, a ball bouncing on a resting ball with a flight too short to be followed stops on it. Its weight pins a
+    // ball sliding on the floor slower than such a bounce, else the ball would bounce on it without loss until it stops.
+    double Rebound = -RestitutionCoef * Approach * fabs (NY);
+
+    if (Landing && m_BallGravity [Upper] > 0 && 2 * Rebound / m_BallGravity [Upper] < REST_FLIGHT_TIME &&
+        (m_Stopped [Lower] || (m_Y [Lower] <= 0 && fabs (m_VelX [Lower]) < m_BallGravity [Upper] * REST_FLIGHT_TIME)))
+    {
+        if (! m_Stopped [Lower])
+            Launch (Lower, 0, 0);
+
+        m_VelX [Upper] = 0;
+        m_VelY [Upper] = 0;
+        m_Gravity [Upper] = 0;
+        m_Friction [Upper] = 0;
+        m_Resting [Upper] = true;
+        m_Stopped [Upper] = true;
+    }
+
+}// Collide ()
+
+// Process the first event if it happens before Limit, return false if there is none.
+bool CEventWorld::ProcessEvent (double Limit)
+{
+    if (! m_Started)
+        Start ();
+
+    Event Current;
+
+    for (;;)
+    {
+        if (m_Events.empty () || m_Events.front ().Time > Limit)
+            return false;
+
+        Current = m_Events.front ();
+        pop_heap (m_Events.begin (), m_Events.end (), EventLater ());
+        m_Events.pop_back ();
+
+        if (IsValid (Current))
+            break;
+
+        // Only the other ball changed since, the event was the first one of the ball : compute its next one again.
+        ++m_StaleCount;
+        if (Current.Count == m_EventCount [Current.Ball])
+        {
+            m_Now = Current.Time;
+            Update (Current.Ball);
+            Predict (Current.Ball);
+        }
+    }
+
+    // Move the balls to the time of the event and process it.
+    m_Now = Current.Time;
+    Update (Current.Ball);
+    if (Current.Other != NoBall)
+        Update (Current.Other);
+
+    if (Current.Type == EVENT_WALL)
+        WallBounce (Current.Ball, Current.Code);
+    else if (Current.Type == EVENT_BALL)
+        Collide (Current.Ball, Current.Other);
+    else if (Current.Type == EVENT_CELL)
+        MoveToCell (Current.Ball, Current.Code);
+    else
+        Launch (Current.Ball, 0, 0);
+
+    // Every event computed before for these balls is now out of date.
+    ++m_EventCount [Current.Ball];
+    if (Current.Other != NoBall)
+        ++m_EventCount [Current.Other];
+
+    Predict (Current.Ball);
+    if (Current.Other != NoBall)
+        Predict (Current.Other);
+
+    ++m_EventNumber;
+
+    // Too many out of date events, the heap gets too big.
+    if (m_Events.size () > 16 * (m_X.size () + 64))
+        Compact ();
+
+    return true;
+
+}// ProcessEvent ()
+
+// Process the next event if it comes before the time Limit, return its time (negative if nothing happens before).
+double CEventWorld::NextEvent (double Limit /* = numeric_limits <double>::infinity ()*/)
+{
+    if (! ProcessEvent (Limit))
+        return -1;
+
+    return m_Now;
+
+}// NextEvent ()
+
+// Process every event until the time Time.
+void CEventWorld::AdvanceTo (double Time)
+{
+    while (ProcessEvent (Time))
+        ;
+
+    if (Time > m_Now)
+        m_Now = Time;
+
+}// AdvanceTo ()
+
+// Return the time elapsed since the beginning of the simulation.
+double CEventWorld::GetTime () const
+{
+    return m_Now;
+
+}// GetTime ()
+
+// Return the number of balls.
+unsigned CEventWorld::GetBallCount () const
+{
+    return m_X.size ();
+
+}// GetBallCount ()
+
+// Return the current position of a ball.
+pair <float, float> CEventWorld::GetPosition (unsigned Ball) const
+{
+    double X;
+    double Y;
+    double VelX;
+    double VelY;
+    StateAt (Ball, m_Now, X, Y, VelX, VelY);
+
+    return make_pair ((float) X, (float) Y);
+
+}// GetPosition ()
+
+// Return the current velocity of a ball.
+pair <float, float> CEventWorld::GetVelocity (unsigned Ball) const
+{
+    double X;
+    double Y;
+    double VelX;
+    double VelY;
+    StateAt (Ball, m_Now, X, Y, VelX, VelY);
+
+    return make_pair ((float) VelX, (float) VelY);
+
+}// GetVelocity ()
+
+// Return the number of bounces of a ball on the walls, the floor and the roof.
+unsigned CEventWorld::GetBounceCount (unsigned Ball) const
+{
+    return m_BounceCount [Ball];
+
+}// GetBounceCount ()
+
+// Return the number of events processed.
+unsigned long CEventWorld::GetEventCount () const
+{
+    return m_EventNumber;
+
+}// GetEventCount ()
+
+// Return the number of collisions between balls.
+unsigned long CEventWorld::GetCollisionCount () const
+{
+    return m_CollisionCount;
+
+}// GetCollisionCount ()
+
+// Return the number of out of date events dropped.
+unsigned long CEventWorld::GetStaleEventCount () const
+{
+    return m_StaleCount;
+
+}// GetStaleEventCount ()
@@ -0,0 +1,194 @@
+/**
+ *
+ * @file CEventWorld.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CEventWorld header file.
+ *
+ * @details Contain declaration of the class CEventWorld, the event driven world of hard balls.
+ *          The times of the next impacts on the walls, of the next contacts between balls and of the next cell
+ *          changes are computed in closed form, the first one of each ball is kept in a binary heap. The events made out
+ *          of date by an earlier one are not removed : each ball counts its events, an event remembers the counts it was
+ *          computed with.
+ *
+ * @see CEventWorld.cpp
+ *
+ **/
+
+#ifndef __CEVENTWORLD_H__
+#define __CEVENTWORLD_H__
+
+#include <vector>       // std::vector
+#include <utility>      // std::pair
+#include <limits>       // std::numeric_limits
+
+#include "common.h"     // Settings struct
+
+/*
+** CEventWorld class that processes the impacts and the contacts of many balls in time order.
+*/
+class CEventWorld
+{
+    public :
+
+        // Initialize an empty world of balls of radius Radius.
+        CEventWorld (float Radius = 0);
+
+        // Reserve memory for BallNumber balls.
+        void Reserve (unsigned BallNumber);
+
+        // Add a ball launched with the parameters from the abscissa X, return its index. The balls are added before the first event.
+        unsigned AddBall (const nsTools::Settings &Parameters, float X = 0);
+
+        // Process the next event if it comes before the time Limit, return its time (negative if nothing happens before).
+        double NextEvent (double Limit = std::numeric_limits <double>::infinity ());
+
+        // Process every event until the time Time.
+        void AdvanceTo (double Time);
+
+        // Return the time elapsed since the beginning of the simulation.
+        double GetTime () const;
+
+        // Return the number of balls.
+        unsigned GetBallCount () const;
+
+        // Return the current position of a ball.
+        std::pair <float, float> GetPosition (unsigned Ball) const;
+
+        // Return the current velocity of a ball.
+        std::pair <float, float> GetVelocity (unsigned Ball) const;
+
+        // Return the number of bounces of a ball on the walls, the floor and the roof.
+        unsigned GetBounceCount (unsigned Ball) const;
+
+        // Return the number of events processed, of collisions between balls and of out of date events dropped.
+        unsigned long GetEventCount () const;
+        unsigned long GetCollisionCount () const;
+        unsigned long GetStaleEventCount () const;
+
+    private :
+
+        // The kinds of event.
+        typedef enum{EVENT_WALL, EVENT_BALL, EVENT_CELL, EVENT_STOP} EventType;
+
+        // Store an event.
+        struct Event
+        {
+            double Time;            // the time of the event.
+            EventType Type;         // the kind of event.
+            unsigned Ball;          // the ball.
+            unsigned Other;         // the other ball (EVENT_BALL).
+            unsigned Code;          // the touched surfaces (EVENT_WALL) or the new cell (EVENT_CELL).
+            unsigned Count;         // the number of events of the ball when computed.
+            unsigned OtherCount;    // the number of events of the other ball when computed.
+        };
+
+        // Order of the heap, the first event on top.
+        struct EventLater
+        {
+            bool operator () (const Event &A, const Event &B) const
+            {
+                return A.Time > B.Time;
+            }
+        };
+
+        // Build the grid and compute the first events of every ball.
+        void Start ();
+
+        // Process the first event if it happens before Limit, return false if there is none.
+        bool ProcessEvent (double Limit);
+
+        // Tells if an event is still up to date.
+        bool IsValid (const Event &Current) const;
+
+        // Add an event to the heap.
+        void Schedule (EventType Type, double Time, unsigned Ball, unsigned Other, unsigned Code);
+
+        // Remove the out of date events from the heap.
+        void Compact ();
+
+        // Give the state of a ball at the time Time.
+        void StateAt (unsigned Ball, double Time, double &X, double &Y, double &VelX, double &VelY) const;
+
+        // Move the state of a ball to the current time.
+        void Update (unsigned Ball);
+
+        // Compute the next event of a ball.
+        void Predict (unsigned Ball);
+
+        // Make a ball bounce on the surfaces of Code.
+        void WallBounce (unsigned Ball, unsigned Code);
+
+        // Make two balls in contact bounce on each other.
+        void Collide (unsigned A, unsigned B);
+
+        // Return the part of an impulse along (DirX, DirY) a ball takes, its inverse mass along this direction.
+        double GetMobility (unsigned Ball, double DirX, double DirY) const;
+
+        // Give an impulse along (DirX, DirY) to a ball.
+        void Push (unsigned Ball, double Impulse, double DirX, double DirY);
+
+        // Start a new flight of a ball with a new velocity, a ball lying on the floor stays on it unless thrown upward.
+        void Launch (unsigned Ball, double VelX, double VelY);
+
+        // Return the cell of a point, and move a ball to a cell.
+        unsigned GetCell (double X, double Y) const;
+        void MoveToCell (unsigned Ball, unsigned Cell);
+
+        // State of the balls at the time m_Time.
+        std::vector <double> m_X;
+        std::vector <double> m_Y;
+        std::vector <double> m_VelX;
+        std::vector <double> m_VelY;
+        std::vector <double> m_Time;
+
+        // Gravity of the current flight (0 once the balls slide on the floor), and gravity the balls are attracted by.
+        std::vector <double> m_Gravity;
+        std::vector <double> m_BallGravity;
+
+        // Friction slowing down the balls sliding on the floor, along their velocity (0 in flight).
+        std::vector <double> m_Friction;
+
+        // Coefficient of restitution of the balls.
+        std::vector <float> m_RestitutionCoef;
+
+        // Number of bounces of the balls, number of processed events and time of the last collision with a ball.
+        std::vector <unsigned> m_BounceCount;
+        std::vector <unsigned> m_EventCount;
+        std::vector <double> m_LastCollision;
+
+        // Tells if the balls slide on the floor, and if they stopped.
+        std::vector <bool> m_Resting;
+        std::vector <bool> m_Stopped;
+
+        // Grid : cell of each ball, first ball of each cell and doubly linked lists of the balls of a cell.
+        std::vector <unsigned> m_Cell;
+        std::vector <unsigned> m_CellHead;
+        std::vector <unsigned> m_Next;
+        std::vector <unsigned> m_Previous;
+        unsigned m_Columns;
+        unsigned m_Rows;
+        double m_CellWidth;
+        double m_CellHeight;
+
+        // Heap of the events.
+        std::vector <Event> m_Events;
+
+        // Radius of the balls.
+        double m_Radius;
+
+        // Current time, and tells if the first events were computed.
+        double m_Now;
+        bool m_Started;
+
+        // Counters.
+        unsigned long m_EventNumber;
+        unsigned long m_CollisionCount;
+        unsigned long m_StaleCount;
+};
+#endif // __CEVENTWORLD_H__
@@ -0,0 +1,112 @@
+/**
+ *
+ * @file CForceField.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CForceField source file.
+ *
+ * @details Contain the implementation of the class CForceField.
+ *
+ * @see CForceField.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <string>       // std::string, std::getline
+#include <fstream>      // std::ifstream
+#include <sstream>      // std::istringstream
+
+#include "CForceField.h"    // Class header
+#include "batch.h"          // BatchGridSampling
+#include "common.h"         // ARENA_WIDTH, ARENA_HEIGHT
+
+using namespace std;
+using namespace nsTools;
+
+// Initialize a field of 2 x 2 null accelerations.
+CForceField::CForceField ()
+{
+    const float Null [4] = {0, 0, 0, 0};
+    SetAccelerations (2, 2, Null, Null);
+
+}// CForceField ()
+
+// Set the accelerations of Columns x Rows nodes.
+void CForceField::SetAccelerations (unsigned Columns, unsigned Rows, const float *AccelX, const float *AccelY)
+{
+    m_AccelX.assign (AccelX, AccelX + Columns * Rows);
+    m_AccelY.assign (AccelY, AccelY + Columns * Rows);
+    m_Columns = Columns;
+    m_Rows = Rows;
+    m_ScaleX = (Columns - 1) / (float) ARENA_WIDTH;
+    m_ScaleY = (Rows - 1) / (float) ARENA_HEIGHT;
+
+}// SetAccelerations ()
+
+// Read the field of a file.
+bool CForceField::Load (const char *FileName)
+{
+    ifstream File (FileName);
+    if (! File)
+        return false;
+
+    // The whole file without its comments.
+    string Text;
+    string Line;
+    while (getline (File, Line))
+        Text += Line.substr (0, Line.find ('#')) + '\n';
+
+    istringstream Values (Text);
+    unsigned Columns;
+    unsigned Rows;
+    if (! (Values >> Columns >> Rows) || Columns < 2 || Rows < 2)
+        return false;
+
+    vector <float> AccelX (Columns * Rows);
+    vector <float> AccelY (Columns * Rows);
+    for (unsigned i = 0; i < Columns * Rows; ++i)
+        if (! (Values >> AccelX [i] >> AccelY [i]))
+            return false;
+
+    float Extra;
+    if (Values >> Extra)
+        return false;
+
+    SetAccelerations (Columns, Rows, AccelX.data (), AccelY.data ());
+
+    return true;
+
+}// Load ()
+
+// Return the number of columns of nodes.
+unsigned CForceField::GetColumnCount () const
+{
+    return m_Columns;
+
+}// GetColumnCount ()
+
+// Return the number of rows of nodes.
+unsigned CForceField::GetRowCount () const
+{
+    return m_Rows;
+
+}// GetRowCount ()
+
+// Give the acceleration at the point (X, Y).
+void CForceField::Sample (float X, float Y, float &AccelX, float &AccelY) const
+{
+    Sample (&X, &Y, &AccelX, &AccelY, 1);
+
+}// Sample ()
+
+// Give the accelerations at Count points.
+void CForceField::Sample (const float *X, const float *Y, float *AccelX, float *AccelY, unsigned Count) const
+{
+    BatchGridSampling (m_AccelX.data (), m_AccelY.data (), m_Columns, m_Rows, m_ScaleX, m_ScaleY, X, Y, AccelX, AccelY, Count);
+
+}// Sample ()
@@ -0,0 +1,67 @@
+/**
+ *
+ * @file CForceField.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CForceField header file.
+ *
+ * @details Contain declaration of the class CForceField, the accelerations (wind, attractors, gravity wells) given at the nodes
+ *          of a grid spread regularly over the arena, added to the gravity of the balls. Between the nodes the acceleration
+ *          is interpolated bilinearly, for many balls at once with the batched functions.
+ *
+ * @see CForceField.cpp
+ *
+ **/
+
+#ifndef __CFORCEFIELD_H__
+#define __CFORCEFIELD_H__
+
+#include <vector>       // std::vector
+
+/*
+** CForceField class that gives the acceleration of the balls at any point of the arena.
+*/
+class CForceField
+{
+    public :
+
+        // Initialize a field of 2 x 2 null accelerations.
+        CForceField ();
+
+        // Set the accelerations of Columns x Rows nodes (at least 2 x 2), stored row after row from the floor, spread from a wall to the other one.
+        void SetAccelerations (unsigned Columns, unsigned Rows, const float *AccelX, const float *AccelY);
+
+        // Read the field of a file : the numbers of columns and rows, then the "AX AY" acceleration of each node, row after row
+        // from the floor. '#' starts a comment. Return false if the file can not be read or is wrong.
+        bool Load (const char *FileName);
+
+        // Return the number of columns and rows of nodes.
+        unsigned GetColumnCount () const;
+        unsigned GetRowCount () const;
+
+        // Give the acceleration at the point (X, Y).
+        void Sample (float X, float Y, float &AccelX, float &AccelY) const;
+
+        // Give the accelerations at Count points.
+        void Sample (const float *X, const float *Y, float *AccelX, float *AccelY, unsigned Count) const;
+
+    private :
+
+        // Accelerations of the nodes, row after row.
+        std::vector <float> m_AccelX;
+        std::vector <float> m_AccelY;
+
+        // Number of columns and rows of nodes.
+        unsigned m_Columns;
+        unsigned m_Rows;
+
+        // Number of nodes per meter.
+        float m_ScaleX;
+        float m_ScaleY;
+};
+#endif // __CFORCEFIELD_H__
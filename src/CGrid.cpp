@@ -0,0 +1,172 @@
+/**
+ *
+ * @file CGrid.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CGrid source file.
+ *
+ * @details Contain the implementation of the class CGrid.
+ *
+ * @see CGrid.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <algorithm>    // std::fill, std::min
+#include <math.h>       // ceil
+
+#include "CGrid.h"      // Class header
+#include "common.h"     // ARENA_WIDTH, ARENA_HEIGHT
+
+using namespace std;
+
+namespace
+{
+    // Under this number of points for each block, starting the jobs costs more than it saves.
+    const unsigned MinPointsPerBlock = 16384;
+}
+
+// Initialize an empty grid.
+CGrid::CGrid () : m_CellSize (1), m_InvCellSize (1), m_Columns (0), m_Rows (0)
+{
+
+}// CGrid ()
+
+// Sort Count points by cells of CellSize meters, the points must be inside the arena.
+void CGrid::Build (const float *X, const float *Y, unsigned Count, float CellSize, CJobSystem *Jobs/* = 0*/)
+{
+    m_CellSize = CellSize;
+    m_InvCellSize = 1 / CellSize;
+
+    // One more cell for the points on the right wall and the roof.
+    m_Columns = (unsigned) ceil (ARENA_WIDTH * m_InvCellSize) + 1;
+    m_Rows = (unsigned) ceil (ARENA_HEIGHT * m_InvCellSize) + 1;
+
+    unsigned CellNumber = m_Columns * m_Rows;
+    m_CellStart.resize (CellNumber + 1);
+    m_Points.resize (Count);
+    m_PointCell.resize (Count);
+
+    unsigned BlockNumber = Jobs != 0 ? min (Jobs->GetThreadCount (), Count / MinPointsPerBlock) : 1;
+    if (BlockNumber > 1)
+    {
+        /* COUNTING BY BLOCKS */
+        // Each block of points has its own counts, the threads do not write to the same ones.
+        m_BlockCount.assign (BlockNumber * CellNumber, 0);
+        Jobs->ParallelFor (0, BlockNumber, 1, [&] (unsigned FirstBlock, unsigned LastBlock)
+        {
+            for (unsigned Block = FirstBlock; Block < LastBlock; ++Block)
+            {
+                unsigned *Counts = &m_BlockCount [Block * CellNumber];
+                for (unsigned i = (unsigned long long) Count * Block / BlockNumber; i < (unsigned long long) Count * (Block + 1) / BlockNumber; ++i)
+                {
+                    m_PointCell [i] = GetRow (Y [i]) * m_Columns + GetColumn (X [i]);
+                    ++Counts [m_PointCell [i]];
+                }
+            }
+        });
+
+        // Prefix sum, the points of a block come after the ones of the previous blocks in each cell : the order is the one of a single thread.
+        unsigned Sum = 0;
+        for (unsigned Cell = 0; Cell < CellNumber; ++Cell)
+        {
+            m_CellStart [Cell] = Sum;
+            for (unsigned Block = 0; Block < BlockNumber; ++Block)
+            {
+                unsigned BlockCount = m_BlockCount [Block * CellNumber + Cell];
+                m_BlockCount [Block * CellNumber + Cell] = Sum;
+                Sum += BlockCount;
+            }
+        }
+        m_CellStart [CellNumber] = Sum;
+
+        /* PLACING BY BLOCKS */
+        Jobs->ParallelFor (0, BlockNumber, 1, [&] (unsigned FirstBlock, unsigned LastBlock)
+        {
+            for (unsigned Block = FirstBlock; Block < LastBlock; ++Block)
+            {
+                unsigned *Next = &m_BlockCount [Block * CellNumber];
+                for (unsigned i = (unsigned long long) Count * Block / BlockNumber; i < (unsigned long long) Count * (Block + 1) / BlockNumber; ++i)
+                    m_Points [Next [m_PointCell [i]]++] = i;
+            }
+        });
+
+        return;
+    }
+
+    // Count the points of each cell.
+    fill (m_CellStart.begin (), m_CellStart.end (), 0);
+    for (unsigned i = 0; i < Count; ++i)
+    {
+        m_PointCell [i] = GetRow (Y [i]) * m_Columns + GetColumn (X [i]);
+        ++m_CellStart [m_PointCell [i] + 1];
+    }
+
+    // Prefix sum, the cell i begins after the points of the previous cells.
+    for (unsigned i = 0; i < CellNumber; ++i)
+        m_CellStart [i + 1] += m_CellStart [i];
+
+    // Put each point at the next free place of its cell, the start of each cell is moved forward meanwhile.
+    for (unsigned i = 0; i < Count; ++i)
+        m_Points [m_CellStart [m_PointCell [i]]++] = i;
+
+    // Shift back the starts.
+    for (unsigned i = CellNumber; i > 0; --i)
+        m_CellStart [i] = m_CellStart [i - 1];
+    m_CellStart [0] = 0;
+
+}// Build ()
+
+// Return the number of columns of the grid.
+unsigned CGrid::GetColumns () const
+{
+    return m_Columns;
+
+}// GetColumns ()
+
+// Return the number of rows of the grid.
+unsigned CGrid::GetRows () const
+{
+    return m_Rows;
+
+}// GetRows ()
+
+// Return the column of a point.
+unsigned CGrid::GetColumn (float X) const
+{
+    if (X <= 0)
+        return 0;
+
+    unsigned Column = (unsigned) (X * m_InvCellSize);
+
+    return Column < m_Columns ? Column : m_Columns - 1;
+
+}// GetColumn ()
+
+// Return the row of a point.
+unsigned CGrid::GetRow (float Y) const
+{
+    if (Y <= 0)
+        return 0;
+
+    unsigned Row = (unsigned) (Y * m_InvCellSize);
+
+    return Row < m_Rows ? Row : m_Rows - 1;
+
+}// GetRow ()
+
+// Give the range of the indices of the points of a cell.
+void CGrid::GetCell (unsigned Column, unsigned Row, const unsigned *&Begin, const unsigned *&End) const
+{
+    unsigned Cell = Row * m_Columns + Column;
+    const unsigned *Points = m_Points.data ();
+
+    Begin = Points + m_CellStart [Cell];
+    End = Points + m_CellStart [Cell + 1];
+
+}// GetCell ()
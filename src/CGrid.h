@@ -0,0 +1,75 @@
+/**
+ *
+ * @file CGrid.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CGrid header file.
+ *
+ * @details Contain declaration of the class CGrid, a uniform grid covering the arena.
+ *          The grid is rebuilt from the positions by a counting sort : the indices of the points of a cell
+ *          are contiguous in a single flat array, so the neighbours of a point are read without any allocation.
+ *          With a job system the points are counted and placed by blocks on every thread, in the same order as by one.
+ *
+ * @see CGrid.cpp
+ *
+ **/
+
+#ifndef __CGRID_H__
+#define __CGRID_H__
+
+#include <vector>       // std::vector
+
+#include "CJobSystem.h" // Job system
+
+/*
+** CGrid class that sorts points by cells of the arena to find the close ones.
+*/
+class CGrid
+{
+    public :
+
+        // Initialize an empty grid.
+        CGrid ();
+
+        // Sort Count points by cells of CellSize meters, the points must be inside the arena. Jobs spreads the sort over its threads, 0 for none.
+        void Build (const float *X, const float *Y, unsigned Count, float CellSize, CJobSystem *Jobs = 0);
+
+        // Return the number of columns and rows of the grid.
+        unsigned GetColumns () const;
+        unsigned GetRows () const;
+
+        // Return the column and the row of a point.
+        unsigned GetColumn (float X) const;
+        unsigned GetRow (float Y) const;
+
+        // Give the range of the indices of the points of a cell.
+        void GetCell (unsigned Column, unsigned Row, const unsigned *&Begin, const unsigned *&End) const;
+
+    private :
+
+        // Size of a cell and its inverse.
+        float m_CellSize;
+        float m_InvCellSize;
+
+        // Number of columns and rows.
+        unsigned m_Columns;
+        unsigned m_Rows;
+
+        // Index of the first point of each cell in m_Points, one more for the end of the last cell.
+        std::vector <unsigned> m_CellStart;
+
+        // Indices of the points, sorted by cells.
+        std::vector <unsigned> m_Points;
+
+        // Cell of each point, computed once by Build ().
+        std::vector <unsigned> m_PointCell;
+
+        // Number of points of each cell in each block of points, then the place of the next point, for the sort by blocks.
+        std::vector <unsigned> m_BlockCount;
+};
+#endif // __CGRID_H__
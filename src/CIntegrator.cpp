@@ -0,0 +1,246 @@
+/**
+ *
+ * @file CIntegrator.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CIntegrator source file.
+ *
+ * @details Contain the implementation of the class CIntegrator.
+ *
+ * @see CIntegrator.h
+ *
+ **/
+
+#include <algorithm>    // std::min, std::max
+#include <math.h>       // sqrt, pow, fabs
+
+#include "CIntegrator.h"    // Class header
+
+using namespace std;
+
+namespace
+{
+    // Stages of the Runge-Kutta 4(5) of Dormand and Prince : the coefficients of the previous derivatives for each stage,
+    // the last stage giving the solution of order 5, and the difference with the solution of order 4.
+    const double Stages [7][6] =
+    {
+        {0,                 0,                  0,                  0,              0,                  0},
+        {1.0 / 5,           0,                  0,                  0,              0,                  0},
+        {3.0 / 40,          9.0 / 40,           0,                  0,              0,                  0},
+        {44.0 / 45,         -56.0 / 15,         32.0 / 9,           0,              0,                  0},
+        {19372.0 / 6561,    -25360.0 / 2187,    64448.0 / 6561,     -212.0 / 729,   0,                  0},
+        {9017.0 / 3168,     -355.0 / 33,        46732.0 / 5247,     49.0 / 176,     -5103.0 / 18656,    0},
+        {35.0 / 384,        0,                  500.0 / 1113,       125.0 / 192,    -2187.0 / 6784,     11.0 / 84}
+    };
+    const double ErrorCoefs [7] = {71.0 / 57600, 0, -71.0 / 16695, 71.0 / 1920, -17253.0 / 339200, 22.0 / 525, -1.0 / 40};
+
+    // Bounds of the change of the length of a step of the adaptive method.
+    const double MinGrowth = 0.2;
+    const double MaxGrowth = 5;
+
+    // Shortest step of the adaptive method, accepted whatever its error.
+    const double MinSubStep = 1e-9;
+}
+
+// Initialize an integrator without drag.
+CIntegrator::CIntegrator (Method Kind/* = RK4*/) : m_Method (Kind), m_Linear (0), m_Quadratic (0), m_Tolerance (1e-6), m_SubStep (0)
+{
+
+}// CIntegrator ()
+
+// Set the integration method.
+void CIntegrator::SetMethod (Method Kind)
+{
+    m_Method = Kind;
+    m_SubStep = 0;
+
+}// SetMethod ()
+
+// Return the integration method.
+CIntegrator::Method CIntegrator::GetMethod () const
+{
+    return m_Method;
+
+}// GetMethod ()
+
+// Return the name of a method.
+const char *CIntegrator::GetMethodName (Method Kind)
+{
+    switch (Kind)
+    {
+        case EULER :
+            return "euler";
+        case VERLET :
+            return "verlet";
+        case RK4 :
+            return "rk4";
+        default :
+            return "rk45";
+    }
+
+}// GetMethodName ()
+
+// Set the drag of a ball of 1 kg.
+void CIntegrator::SetDrag (double Linear, double Quadratic)
+{
+    m_Linear = Linear;
+    m_Quadratic = Quadratic;
+
+}// SetDrag ()
+
+// Set the largest error of a step of the adaptive method.
+void CIntegrator::SetTolerance (double Tolerance)
+{
+    m_Tolerance = Tolerance;
+
+}// SetTolerance ()
+
+// Give the acceleration of the ball at the velocity (VelX, VelY).
+void CIntegrator::Acceleration (double VelX, double VelY, double Gravity, double &AccelX, double &AccelY) const
+{
+    double Drag = m_Linear + m_Quadratic * sqrt (VelX * VelX + VelY * VelY);
+
+    AccelX = -Drag * VelX;
+    AccelY = -Gravity - Drag * VelY;
+
+}// Acceleration ()
+
+// Move the ball of TimeStep seconds with the Runge-Kutta 4(5) of Dormand and Prince.
+void CIntegrator::DormandPrince (double State [4], double Gravity, double TimeStep, double &Error) const
+{
+    // Derivatives of the position and the velocity at each stage.
+    double Slopes [7][4];
+
+    for (unsigned Stage = 0; Stage < 7; ++Stage)
+    {
+        double Point [4] = {State [0], State [1], State [2], State [3]};
+        for (unsigned Previous = 0; Previous < Stage; ++Previous)
+            for (unsigned k = 0; k < 4; ++k)
+                Point [k] += TimeStep * Stages [Stage][Previous] * Slopes [Previous][k];
+
+        Slopes [Stage][0] = Point [2];
+        Slopes [Stage][1] = Point [3];
+        Acceleration (Point [2], Point [3], Gravity, Slopes [Stage][2], Slopes [Stage][3]);
+    }
+
+    // The last stage is taken at the solution of order 5, its derivative only serves the error.
+    Error = 0;
+    for (unsigned k = 0; k < 4; ++k)
+    {
+        double Difference = 0;
+        for (unsigned Stage = 0; Stage < 7; ++Stage)
+            Difference += ErrorCoefs [Stage] * Slopes [Stage][k];
+
+        Error = max (Error, fabs (TimeStep * Difference));
+
+        for (unsigned Stage = 0; Stage < 6; ++Stage)
+            State [k] += TimeStep * Stages [6][Stage] * Slopes [Stage][k];
+    }
+
+}// DormandPrince ()
+
+// Move the ball of TimeStep seconds.
+unsigned CIntegrator::Step (double &X, double &Y, double &VelX, double &VelY, double Gravity, double TimeStep)
+{
+    double AccelX;
+    double AccelY;
+
+    switch (m_Method)
+    {
+        /* SEMI-IMPLICIT EULER : THE NEW VELOCITY MOVES THE BALL */
+        case EULER :
+            Acceleration (VelX, VelY, Gravity, AccelX, AccelY);
+            VelX += AccelX * TimeStep;
+            VelY += AccelY * TimeStep;
+            X += VelX * TimeStep;
+            Y += VelY * TimeStep;
+            return 1;
+
+        /* VELOCITY VERLET, THE ACCELERATION AT THE END TAKEN AT THE PREDICTED VELOCITY */
+        case VERLET :
+        {
+            Acceleration (VelX, VelY, Gravity, AccelX, AccelY);
+            X += (VelX + 0.5 * AccelX * TimeStep) * TimeStep;
+            Y += (VelY + 0.5 * AccelY * TimeStep) * TimeStep;
+
+            double EndAccelX;
+            double EndAccelY;
+            Acceleration (VelX + AccelX * TimeStep, VelY + AccelY * TimeStep, Gravity, EndAccelX, EndAccelY);
+            VelX += 0.5 * (AccelX + EndAccelX) * TimeStep;
+            VelY += 0.5 * (AccelY + EndAccelY) * TimeStep;
+            return 2;
+        }
+
+        /* CLASSICAL RUNGE-KUTTA 4 */
+        case RK4 :
+        {
+            // The acceleration does not depend on the position, only the velocities of the stages are needed.
+            double KX [4];
+            double KY [4];
+            double KVX [4];
+            double KVY [4];
+            const double Fractions [4] = {0, 0.5, 0.5, 1};
+
+            for (unsigned Stage = 0; Stage < 4; ++Stage)
+            {
+                KX [Stage] = VelX + (Stage > 0 ? Fractions [Stage] * TimeStep * KVX [Stage - 1] : 0);
+                KY [Stage] = VelY + (Stage > 0 ? Fractions [Stage] * TimeStep * KVY [Stage - 1] : 0);
+                Acceleration (KX [Stage], KY [Stage], Gravity, KVX [Stage], KVY [Stage]);
+            }
+
+            X += TimeStep / 6 * (KX [0] + 2 * KX [1] + 2 * KX [2] + KX [3]);
+            Y += TimeStep / 6 * (KY [0] + 2 * KY [1] + 2 * KY [2] + KY [3]);
+            VelX += TimeStep / 6 * (KVX [0] + 2 * KVX [1] + 2 * KVX [2] + KVX [3]);
+            VelY += TimeStep / 6 * (KVY [0] + 2 * KVY [1] + 2 * KVY [2] + KVY [3]);
+            return 4;
+        }
+
+        /* ADAPTIVE RUNGE-KUTTA 4(5) */
+        default :
+        {
+            double State [4] = {X, Y, VelX, VelY};
+            double Left = TimeStep;
+            unsigned Evaluations = 0;
+
+            if (m_SubStep <= 0)
+                m_SubStep = TimeStep;
+
+            while (Left > 0)
+            {
+                // The last step ends exactly at TimeStep, without changing the length kept for the next one.
+                double SubStep = min (m_SubStep, Left);
+                double Trial [4] = {State [0], State [1], State [2], State [3]};
+                double Error;
+                DormandPrince (Trial, Gravity, SubStep, Error);
+                Evaluations += 7;
+
+                bool Accepted = Error <= m_Tolerance || SubStep <= MinSubStep;
+                if (Accepted)
+                {
+                    for (unsigned k = 0; k < 4; ++k)
+                        State [k] = Trial [k];
+                    Left -= SubStep;
+                }
+
+                // The error of an order 4 step goes with the fifth power of its length.
+                double Growth = Error > 0 ? 0.9 * pow (m_Tolerance / Error, 0.2) : MaxGrowth;
+                double Next = SubStep * min (MaxGrowth, max (MinGrowth, Growth));
+                if (Accepted && SubStep < m_SubStep)
+                    Next = max (Next, m_SubStep);
+                m_SubStep = max (MinSubStep, min (TimeStep, Next));
+            }
+
+            X = State [0];
+            Y = State [1];
+            VelX = State [2];
+            VelY = State [3];
+            return Evaluations;
+        }
+    }
+
+}// Step ()
@@ -0,0 +1,76 @@
+/**
+ *
+ * @file CIntegrator.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CIntegrator header file.
+ *
+ * @details Contain declaration of the class CIntegrator, the numerical integration of a ball slowed down by the air.
+ *          With a drag the trajectory has no closed form anymore : it is integrated by semi-implicit Euler, Verlet,
+ *          Runge-Kutta 4 or an adaptive Runge-Kutta 4(5) keeping its error under a tolerance. Without drag Verlet
+ *          and the Runge-Kutta methods find the parabola again, up to the rounding.
+ *
+ * @see CIntegrator.cpp
+ *
+ **/
+
+#ifndef __CINTEGRATOR_H__
+#define __CINTEGRATOR_H__
+
+/*
+** CIntegrator class that moves a ball under the gravity and the drag.
+*/
+class CIntegrator
+{
+    public :
+
+        // The allowed integration methods.
+        typedef enum{EULER, VERLET, RK4, RK45} Method;
+
+        // Initialize an integrator without drag.
+        CIntegrator (Method Kind = RK4);
+
+        // Set the integration method.
+        void SetMethod (Method Kind);
+
+        // Return the integration method.
+        Method GetMethod () const;
+
+        // Return the name of a method.
+        static const char *GetMethodName (Method Kind);
+
+        // Set the drag of a ball of 1 kg : Linear (1/s) times the velocity, Quadratic (1/m) times the velocity and the speed.
+        void SetDrag (double Linear, double Quadratic);
+
+        // Set the largest error (m and m/s) of a step of the adaptive method.
+        void SetTolerance (double Tolerance);
+
+        // Move the ball of TimeStep seconds, the adaptive method splits it into as many steps as its tolerance needs.
+        // Return the number of times the acceleration was computed.
+        unsigned Step (double &X, double &Y, double &VelX, double &VelY, double Gravity, double TimeStep);
+
+    private :
+
+        // Give the acceleration of the ball at the velocity (VelX, VelY).
+        void Acceleration (double VelX, double VelY, double Gravity, double &AccelX, double &AccelY) const;
+
+        // Move the ball of TimeStep seconds with the Runge-Kutta 4(5) of Dormand and Prince, Error receives the largest difference of its two orders.
+        void DormandPrince (double State [4], double Gravity, double TimeStep, double &Error) const;
+
+        // Integration method.
+        Method m_Method;
+
+        // Drag coefficients.
+        double m_Linear;
+        double m_Quadratic;
+
+        // Tolerance of the adaptive method, and the length of its last step to start the next one, 0 before the first one.
+        double m_Tolerance;
+        double m_SubStep;
+};
+#endif // __CINTEGRATOR_H__
@@ -0,0 +1,279 @@
+/**
+ *
+ * @file CJobSystem.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CJobSystem source file.
+ *
+ * @details Contain the implementation of the class CJobSystem.
+ *
+ * @see CJobSystem.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <algorithm>    // std::max
+
+#include "CJobSystem.h"     // Class header
+
+using namespace std;
+
+namespace
+{
+    // Pool and queue of the current thread, the first queue for the threads not in a pool.
+    thread_local const CJobSystem *CurrentSystem = 0;
+    thread_local unsigned CurrentQueue = 0;
+}
+
+// Store a job.
+struct CJobSystem::Job
+{
+    function <void ()> Work;            // the function to run.
+    atomic <unsigned> Pending;          // the number of dependencies not done, plus one until the job is submitted.
+    atomic <bool> Done;                 // tells if the job is done.
+    mutex Lock;                         // protects Dependents, and Done while they are added.
+    vector <Handle> Dependents;         // the jobs waiting for this one.
+};
+
+// Start ThreadCount - 1 threads, 0 for one per core.
+CJobSystem::CJobSystem (unsigned ThreadCount/* = 0*/) : m_Ready (0), m_Sleeping (0), m_Stopping (false)
+{
+    // The number of cores may be unknown.
+    if (ThreadCount == 0)
+        ThreadCount = thread::hardware_concurrency ();
+    ThreadCount = max (ThreadCount, 1u);
+
+    for (unsigned i = 0; i < ThreadCount; ++i)
+        m_Queues.push_back (new Queue);
+
+    for (unsigned i = 1; i < ThreadCount; ++i)
+        m_Threads.push_back (thread (&CJobSystem::WorkerLoop, this, i));
+
+}// CJobSystem ()
+
+// Stop the threads.
+CJobSystem::~CJobSystem ()
+{
+    {
+        lock_guard <mutex> Lock (m_SleepLock);
+        m_Stopping = true;
+    }
+    m_Sleep.notify_all ();
+
+    for (unsigned i = 0; i < m_Threads.size (); ++i)
+        m_Threads [i].join ();
+
+    for (unsigned i = 0; i < m_Queues.size (); ++i)
+        delete m_Queues [i];
+
+}// ~CJobSystem ()
+
+// Return the number of threads running jobs.
+unsigned CJobSystem::GetThreadCount () const
+{
+    return m_Queues.size ();
+
+}// GetThreadCount ()
+
+// Return the queue of the current thread.
+unsigned CJobSystem::GetQueue () const
+{
+    return CurrentSystem == this ? CurrentQueue : 0;
+
+}// GetQueue ()
+
+// Submit a job.
+CJobSystem::Handle CJobSystem::Submit (const function <void ()> &Work, const vector <Handle> &Dependencies/* = vector <Handle> ()*/)
+{
+    Handle New = make_shared <Job> ();
+    New->Work = Work;
+    New->Pending = 1;
+    New->Done = false;
+
+    // A dependency done meanwhile is not waited for, it will not release the job.
+    for (unsigned i = 0; i < Dependencies.size (); ++i)
+    {
+        lock_guard <mutex> Lock (Dependencies [i]->Lock);
+        if (! Dependencies [i]->Done)
+        {
+            Dependencies [i]->Dependents.push_back (New);
+            ++New->Pending;
+        }
+    }
+
+    Release (New);
+
+    return New;
+
+}// Submit ()
+
+// Tells if a job is done.
+bool CJobSystem::IsDone (const Handle &Submitted) const
+{
+    return Submitted->Done;
+
+}// IsDone ()
+
+// Make the job ready to run once none of its dependencies is left.
+void CJobSystem::Release (const Handle &Ready)
+{
+    if (--Ready->Pending == 0)
+        Push (Ready);
+
+}// Release ()
+
+// Put a ready job on the queue of the current thread.
+void CJobSystem::Push (const Handle &Ready)
+{
+    Queue &Own = *m_Queues [GetQueue ()];
+    {
+        lock_guard <mutex> Lock (Own.Lock);
+        Own.Jobs.push_back (Ready);
+    }
+    ++m_Ready;
+
+    WakeUp (false);
+
+}// Push ()
+
+// Wake up the sleeping threads.
+void CJobSystem::WakeUp (bool All)
+{
+    // The state was changed before taking the lock : a thread about to sleep either sees it or is already asleep.
+    {
+        lock_guard <mutex> Lock (m_SleepLock);
+        if (m_Sleeping == 0)
+            return;
+    }
+
+    if (All)
+        m_Sleep.notify_all ();
+    else
+        m_Sleep.notify_one ();
+
+}// WakeUp ()
+
+// Run a job of the queue of the current thread or stolen from another one.
+bool CJobSystem::RunOne ()
+{
+    if (m_Ready == 0)
+        return false;
+
+    unsigned Own = GetQueue ();
+    unsigned QueueNumber = m_Queues.size ();
+    Handle Next;
+
+    // The last job of its own queue is the one whose data is the most likely in the cache.
+    {
+        lock_guard <mutex> Lock (m_Queues [Own]->Lock);
+        if (! m_Queues [Own]->Jobs.empty ())
+        {
+            Next = m_Queues [Own]->Jobs.back ();
+            m_Queues [Own]->Jobs.pop_back ();
+        }
+    }
+
+    // The oldest job of another queue is the largest part of a split range.
+    for (unsigned i = 1; ! Next && i < QueueNumber; ++i)
+    {
+        Queue &Other = *m_Queues [(Own + i) % QueueNumber];
+        lock_guard <mutex> Lock (Other.Lock);
+        if (! Other.Jobs.empty ())
+        {
+            Next = Other.Jobs.front ();
+            Other.Jobs.pop_front ();
+        }
+    }
+
+    if (! Next)
+        return false;
+
+    --m_Ready;
+    Next->Work ();
+
+    // The dependents are released out of the lock, the jobs submitted later do not wait anymore.
+    vector <Handle> Dependents;
+    {
+        lock_guard <mutex> Lock (Next->Lock);
+        Next->Done = true;
+        Dependents.swap (Next->Dependents);
+    }
+
+    for (unsigned i = 0; i < Dependents.size (); ++i)
+        Release (Dependents [i]);
+
+    WakeUp (true);
+
+    return true;
+
+}// RunOne ()
+
+// Run jobs until Finished () is true, sleep while there is none to run.
+void CJobSystem::Help (const function <bool ()> &Finished)
+{
+    while (! Finished ())
+    {
+        if (RunOne ())
+            continue;
+
+        unique_lock <mutex> Lock (m_SleepLock);
+        ++m_Sleeping;
+        m_Sleep.wait (Lock, [&] () { return m_Stopping || m_Ready > 0 || Finished (); });
+        --m_Sleeping;
+
+        if (m_Stopping)
+            return;
+    }
+
+}// Help ()
+
+// Run jobs until the pool is stopped.
+void CJobSystem::WorkerLoop (unsigned Index)
+{
+    CurrentSystem = this;
+    CurrentQueue = Index;
+
+    Help ([this] () { return m_Stopping.load (); });
+
+}// WorkerLoop ()
+
+// Run other jobs until a job is done.
+void CJobSystem::Wait (const Handle &Submitted)
+{
+    Help ([&Submitted] () { return Submitted->Done.load (); });
+
+}// Wait ()
+
+// Call Body on ranges of at most Grain indexes covering [Begin, End).
+void CJobSystem::ParallelFor (unsigned Begin, unsigned End, unsigned Grain, const function <void (unsigned, unsigned)> &Body)
+{
+    if (End <= Begin)
+        return;
+
+    Grain = max (Grain, 1u);
+
+    // The upper half of a range is left to the other threads and the lower one split again, until it is small enough.
+    atomic <unsigned> Left (1);
+    function <void (unsigned, unsigned)> Split = [&] (unsigned First, unsigned Last)
+    {
+        while (Last - First > Grain)
+        {
+            unsigned Middle = First + (Last - First) / 2;
+            ++Left;
+            Submit ([&Split, Middle, Last] () { Split (Middle, Last); });
+            Last = Middle;
+        }
+
+        Body (First, Last);
+        --Left;
+    };
+
+    Split (Begin, End);
+    Help ([&Left] () { return Left.load () == 0; });
+
+}// ParallelFor ()
@@ -0,0 +1,113 @@
+/**
+ *
+ * @file CJobSystem.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CJobSystem header file.
+ *
+ * @details Contain declaration of the class CJobSystem, a pool of threads running small jobs of a frame or a step.
+ *          Each thread has its own queue : it takes its last job first, and takes the oldest job of another queue when
+ *          its own one is empty (work stealing). A job may wait for other jobs before starting. A thread waiting for
+ *          a job runs other jobs meanwhile, and the threads without any job sleep instead of spinning.
+ *
+ * @see CJobSystem.cpp
+ *
+ **/
+
+#ifndef __CJOBSYSTEM_H__
+#define __CJOBSYSTEM_H__
+
+#include <vector>       // std::vector
+#include <deque>        // std::deque
+#include <functional>   // std::function
+#include <memory>       // std::shared_ptr
+#include <thread>       // std::thread
+#include <mutex>        // std::mutex
+#include <condition_variable> // std::condition_variable
+#include <atomic>       // std::atomic
+
+/*
+** CJobSystem class that spreads jobs over the cores.
+*/
+class CJobSystem
+{
+    private :
+
+        // Store a job.
+        struct Job;
+
+    public :
+
+        // Handle of a submitted job.
+        typedef std::shared_ptr <Job> Handle;
+
+        // Start ThreadCount - 1 threads, 0 for one per core : the thread waiting for the jobs is the last one.
+        CJobSystem (unsigned ThreadCount = 0);
+
+        // Stop the threads, the jobs left are not run.
+        ~CJobSystem ();
+
+        // Return the number of threads running jobs, the waiting thread included.
+        unsigned GetThreadCount () const;
+
+        // Submit a job, it starts once every job of Dependencies is done.
+        Handle Submit (const std::function <void ()> &Work, const std::vector <Handle> &Dependencies = std::vector <Handle> ());
+
+        // Tells if a job is done.
+        bool IsDone (const Handle &Submitted) const;
+
+        // Run other jobs until a job is done.
+        void Wait (const Handle &Submitted);
+
+        // Call Body on ranges of at most Grain indexes covering [Begin, End), on every thread, and return once they are done.
+        void ParallelFor (unsigned Begin, unsigned End, unsigned Grain, const std::function <void (unsigned, unsigned)> &Body);
+
+    private :
+
+        // Store the jobs of a thread.
+        struct Queue
+        {
+            std::mutex Lock;
+            std::deque <Handle> Jobs;
+        };
+
+        // Make the job ready to run once none of its dependencies is left.
+        void Release (const Handle &Ready);
+
+        // Put a ready job on the queue of the current thread.
+        void Push (const Handle &Ready);
+
+        // Run a job of the queue of the current thread or stolen from another one, return false if there is none.
+        bool RunOne ();
+
+        // Run jobs until Finished () is true, sleep while there is none to run.
+        void Help (const std::function <bool ()> &Finished);
+
+        // Wake up the sleeping threads, to run new jobs or to see that the ones they wait for are done.
+        void WakeUp (bool All);
+
+        // Run jobs until the pool is stopped, for the thread Index.
+        void WorkerLoop (unsigned Index);
+
+        // Return the queue of the current thread, the first one for the threads not in the pool.
+        unsigned GetQueue () const;
+
+        // Queues of the threads, the first one shared by the threads not in the pool.
+        std::vector <Queue *> m_Queues;
+        std::vector <std::thread> m_Threads;
+
+        // Number of ready jobs in the queues.
+        std::atomic <unsigned> m_Ready;
+
+        // The sleeping threads wait on the condition, which is notified after each new job and each job done.
+        std::mutex m_SleepLock;
+        std::condition_variable m_Sleep;
+        unsigned m_Sleeping;
+        std::atomic <bool> m_Stopping;
+};
+#endif // __CJOBSYSTEM_H__
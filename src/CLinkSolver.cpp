@@ -0,0 +1,343 @@
+/**
+ *
+ * @file CLinkSolver.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CLinkSolver source file.
+ *
+ * @details Contain the implementation of the class CLinkSolver.
+ *
+ * @see CLinkSolver.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <utility>      // std::pair
+#include <algorithm>    // std::min, std::max
+#include <thread>       // std::thread::hardware_concurrency
+#include <math.h>       // sqrt
+
+#include "CLinkSolver.h"    // Class header
+#include "physics.h"        // ClampComputing
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Number of colours given one by one, the links of a ball with more links go to a last colour solved by a single thread.
+    const unsigned MaxColours = 64;
+
+    // Under this number of links for each thread, the jobs of each colour cost more than they save.
+    const unsigned MinLinksPerThread = 512;
+}
+
+// Initialize a solver without links, with one thread per core.
+CLinkSolver::CLinkSolver () : m_Iterations (10), m_ThreadCount (1), m_Jobs (0), m_Coloured (true), m_Overflow (false),
+                              m_PosX (0), m_PosY (0), m_VelX (0), m_VelY (0), m_TimeStep (0)
+{
+    SetThreadCount (0);
+
+}// CLinkSolver ()
+
+// Set the number of passes over the links of each step.
+void CLinkSolver::SetIterations (unsigned Iterations)
+{
+    m_Iterations = Iterations;
+
+}// SetIterations ()
+
+// Set the maximum number of threads, at most one per core, 0 for one per core.
+void CLinkSolver::SetThreadCount (unsigned ThreadCount)
+{
+    // The number of cores may be unknown. More threads than cores would only wait for each other at each colour.
+    unsigned CoreCount = thread::hardware_concurrency ();
+    if (ThreadCount == 0 || (CoreCount != 0 && ThreadCount > CoreCount))
+        ThreadCount = CoreCount;
+
+    m_ThreadCount = max (ThreadCount, 1u);
+
+}// SetThreadCount ()
+
+// Set the job system solving the colours, 0 to solve them on the calling thread.
+void CLinkSolver::SetJobSystem (CJobSystem *Jobs)
+{
+    m_Jobs = Jobs;
+
+}// SetJobSystem ()
+
+// Return the number of passes over the links.
+unsigned CLinkSolver::GetIterations () const
+{
+    return m_Iterations;
+
+}// GetIterations ()
+
+// Return the maximum number of threads.
+unsigned CLinkSolver::GetThreadCount () const
+{
+    return m_ThreadCount;
+
+}// GetThreadCount ()
+
+// Remove every link.
+void CLinkSolver::Clear ()
+{
+    m_Links.clear ();
+    m_Sorted.clear ();
+    m_ColourStart.clear ();
+    m_Coloured = true;
+    m_Overflow = false;
+
+}// Clear ()
+
+// Add a link of Length between the bodies A and B, return its index.
+unsigned CLinkSolver::AddLink (unsigned A, unsigned B, float Length, float Stiffness)
+{
+    Link New = {A, B, 0, 0, Length, Stiffness > 0 ? 1 / Stiffness : 0};
+    m_Links.push_back (New);
+    m_Coloured = false;
+
+    return m_Links.size () - 1;
+
+}// AddLink ()
+
+// Add a link of Length between the body A and the fixed point (X, Y), return its index.
+unsigned CLinkSolver::AddAnchor (unsigned A, float X, float Y, float Length, float Stiffness)
+{
+    Link New = {A, LINK_ANCHOR, X, Y, Length, Stiffness > 0 ? 1 / Stiffness : 0};
+    m_Links.push_back (New);
+    m_Coloured = false;
+
+    return m_Links.size () - 1;
+
+}// AddAnchor ()
+
+// Remove the links of a body.
+void CLinkSolver::RemoveBody (unsigned Body)
+{
+    unsigned Kept = 0;
+    for (unsigned i = 0; i < m_Links.size (); ++i)
+        if (m_Links [i].A != Body && m_Links [i].B != Body)
+            m_Links [Kept++] = m_Links [i];
+
+    if (Kept == m_Links.size ())
+        return;
+
+    m_Links.resize (Kept);
+    m_Coloured = false;
+
+}// RemoveBody ()
+
+// Return the number of links.
+unsigned CLinkSolver::GetLinkCount () const
+{
+    return m_Links.size ();
+
+}// GetLinkCount ()
+
+// Give the bodies of a link.
+void CLinkSolver::GetLink (unsigned Link, unsigned &A, unsigned &B) const
+{
+    A = m_Links [Link].A;
+    B = m_Links [Link].B;
+
+}// GetLink ()
+
+// Return the number of colours of the links.
+unsigned CLinkSolver::GetColourCount () const
+{
+    return m_ColourStart.empty () ? 0 : m_ColourStart.size () - 1;
+
+}// GetColourCount ()
+
+// Sort the links by colours.
+void CLinkSolver::Colour ()
+{
+    unsigned BodyNumber = 0;
+    for (unsigned i = 0; i < m_Links.size (); ++i)
+        BodyNumber = max (BodyNumber, max (m_Links [i].A, m_Links [i].B == LINK_ANCHOR ? 0 : m_Links [i].B) + 1);
+
+    // Colours used by the links of each body, one bit each. A chain takes two colours, a net four.
+    vector <unsigned long long> Used (BodyNumber, 0);
+    vector <unsigned> Colours (m_Links.size ());
+    unsigned ColourNumber = 0;
+    m_Overflow = false;
+
+    for (unsigned i = 0; i < m_Links.size (); ++i)
+    {
+        unsigned long long Taken = Used [m_Links [i].A];
+        if (m_Links [i].B != LINK_ANCHOR)
+            Taken |= Used [m_Links [i].B];
+
+        unsigned Colour = 0;
+        while (Colour < MaxColours && (Taken >> Colour & 1))
+            ++Colour;
+
+        if (Colour < MaxColours)
+        {
+            Used [m_Links [i].A] |= 1ull << Colour;
+            if (m_Links [i].B != LINK_ANCHOR)
+                Used [m_Links [i].B] |= 1ull << Colour;
+        }
+        else
+            m_Overflow = true;
+
+        Colours [i] = Colour;
+        ColourNumber = max (ColourNumber, Colour + 1);
+    }
+
+    // The colours left empty before the last one are removed.
+    vector <unsigned> Renamed (ColourNumber, 0);
+    for (unsigned i = 0; i < m_Links.size (); ++i)
+        Renamed [Colours [i]] = 1;
+
+    unsigned Kept = 0;
+    for (unsigned c = 0; c < ColourNumber; ++c)
+        Renamed [c] = Renamed [c] ? Kept++ : 0;
+    ColourNumber = Kept;
+
+    // Counting sort of the links, as the points of CGrid.
+    m_ColourStart.assign (ColourNumber + 1, 0);
+    for (unsigned i = 0; i < m_Links.size (); ++i)
+    {
+        Colours [i] = Renamed [Colours [i]];
+        ++m_ColourStart [Colours [i] + 1];
+    }
+
+    for (unsigned c = 0; c < ColourNumber; ++c)
+        m_ColourStart [c + 1] += m_ColourStart [c];
+
+    m_Sorted.resize (m_Links.size ());
+    for (unsigned i = 0; i < m_Links.size (); ++i)
+        m_Sorted [m_ColourStart [Colours [i]]++] = m_Links [i];
+
+    for (unsigned c = ColourNumber; c > 0; --c)
+        m_ColourStart [c] = m_ColourStart [c - 1];
+    m_ColourStart [0] = 0;
+
+    m_Coloured = true;
+
+}// Colour ()
+
+// Move the balls to the lengths of the links and change their velocities as much.
+void CLinkSolver::Solve (const unsigned *Slots, unsigned ActiveCount, float *PosX, float *PosY, float *VelX, float *VelY, float TimeStep)
+{
+    if (! m_Coloured)
+        Colour ();
+
+    m_PosX = PosX;
+    m_PosY = PosY;
+    m_VelX = VelX;
+    m_VelY = VelY;
+    m_TimeStep = TimeStep;
+
+    // The bodies change places from one step to the next, the links between sleeping bodies are left.
+    m_States.resize (m_Sorted.size ());
+    for (unsigned i = 0; i < m_Sorted.size (); ++i)
+    {
+        State &Current = m_States [i];
+        Current.SlotA = Slots [m_Sorted [i].A];
+        Current.SlotB = m_Sorted [i].B == LINK_ANCHOR ? LINK_ANCHOR : Slots [m_Sorted [i].B];
+        Current.WeightA = Current.SlotA < ActiveCount ? 1 : 0;
+        Current.WeightB = Current.SlotB < ActiveCount ? 1 : 0;
+        Current.Lambda = 0;
+    }
+
+    // The threads of the job system are not outnumbered, whatever m_ThreadCount.
+    unsigned ThreadNumber = m_Jobs != 0 ? min (m_ThreadCount, m_Jobs->GetThreadCount ()) : 1;
+    ThreadNumber = min (ThreadNumber, max (1u, (unsigned) m_Sorted.size () / MinLinksPerThread));
+
+    unsigned ColourNumber = GetColourCount ();
+    for (unsigned Iteration = 0; Iteration < m_Iterations; ++Iteration)
+        for (unsigned c = 0; c < ColourNumber; ++c)
+        {
+            // The links left over by the others are solved one after the other.
+            SolveColour (c, m_Overflow && c == ColourNumber - 1 ? 1 : ThreadNumber);
+        }
+
+}// Solve ()
+
+// Solve the links of a colour, split into PartNumber parts.
+void CLinkSolver::SolveColour (unsigned Colour, unsigned PartNumber)
+{
+    unsigned Begin = m_ColourStart [Colour];
+    unsigned Size = m_ColourStart [Colour + 1] - Begin;
+
+    if (PartNumber == 1)
+    {
+        for (unsigned i = Begin; i < Begin + Size; ++i)
+            SolveLink (i);
+
+        return;
+    }
+
+    // The links of a colour share no ball, the jobs write to different balls. The next colour reads the balls moved
+    // by this one : ParallelFor returns once every part is done, the calling thread running jobs or sleeping meanwhile.
+    m_Jobs->ParallelFor (0, PartNumber, 1, [this, Begin, Size, PartNumber] (unsigned FirstPart, unsigned LastPart)
+    {
+        unsigned End = Begin + (unsigned long long) Size * LastPart / PartNumber;
+        for (unsigned i = Begin + (unsigned long long) Size * FirstPart / PartNumber; i < End; ++i)
+            SolveLink (i);
+    });
+
+}// SolveColour ()
+
+// Solve a link.
+void CLinkSolver::SolveLink (unsigned Link)
+{
+    const CLinkSolver::Link &Current = m_Sorted [Link];
+    State &Solving = m_States [Link];
+
+    // A sleeping body or an anchor is not moved.
+    float WeightA = Solving.WeightA;
+    float WeightB = Solving.WeightB;
+    if (WeightA + WeightB <= 0)
+        return;
+
+    bool Anchor = Solving.SlotB == LINK_ANCHOR;
+
+    float AX = m_PosX [Solving.SlotA];
+    float AY = m_PosY [Solving.SlotA];
+    float DX = (Anchor ? Current.X : m_PosX [Solving.SlotB]) - AX;
+    float DY = (Anchor ? Current.Y : m_PosY [Solving.SlotB]) - AY;
+    float Distance = sqrt (DX * DX + DY * DY);
+
+    if (Distance <= 0)
+        return;
+
+    // Compliant correction : a rod reaches its length at once, a spring is pulled back by the stiffness, whatever the number of passes.
+    float Alpha = Current.Compliance / (m_TimeStep * m_TimeStep);
+    float Delta = (Current.Length - Distance - Alpha * Solving.Lambda) / (WeightA + WeightB + Alpha);
+    Solving.Lambda += Delta;
+
+    float MoveX = Delta * DX / Distance;
+    float MoveY = Delta * DY / Distance;
+
+    // The velocities change as much as the positions, the arena bounds the moves.
+    if (WeightA > 0)
+    {
+        pair <float, float> A = ClampComputing (make_pair (AX - MoveX * WeightA, AY - MoveY * WeightA));
+        m_VelX [Solving.SlotA] += (A.first - AX) / m_TimeStep;
+        m_VelY [Solving.SlotA] += (A.second - AY) / m_TimeStep;
+        m_PosX [Solving.SlotA] = A.first;
+        m_PosY [Solving.SlotA] = A.second;
+    }
+
+    if (WeightB > 0)
+    {
+        float BX = m_PosX [Solving.SlotB];
+        float BY = m_PosY [Solving.SlotB];
+        pair <float, float> B = ClampComputing (make_pair (BX + MoveX * WeightB, BY + MoveY * WeightB));
+        m_VelX [Solving.SlotB] += (B.first - BX) / m_TimeStep;
+        m_VelY [Solving.SlotB] += (B.second - BY) / m_TimeStep;
+        m_PosX [Solving.SlotB] = B.first;
+        m_PosY [Solving.SlotB] = B.second;
+    }
+
+}// SolveLink ()
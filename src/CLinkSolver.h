@@ -0,0 +1,140 @@
+/**
+ *
+ * @file CLinkSolver.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CLinkSolver header file.
+ *
+ * @details Contain declaration of the class CLinkSolver, the solver of the links keeping balls at a given distance (rods and springs).
+ *          The links move the positions of the balls, the velocities follow the moves. The links are coloured so that
+ *          two links of a same colour never share a ball : the links of a colour are split into jobs of a job system,
+ *          and the next colour starts once they are all done.
+ *
+ * @see CLinkSolver.cpp
+ *
+ **/
+
+#ifndef __CLINKSOLVER_H__
+#define __CLINKSOLVER_H__
+
+#include <vector>       // std::vector
+
+#include "CJobSystem.h" // Job system
+
+// Other body of a link holding a ball to a fixed point.
+#define LINK_ANCHOR     0xFFFFFFFFu
+
+/*
+** CLinkSolver class that keeps linked balls at the length of their links.
+*/
+class CLinkSolver
+{
+    public :
+
+        // Initialize a solver without links, with one thread per core.
+        CLinkSolver ();
+
+        // Set the number of passes over the links of each step.
+        void SetIterations (unsigned Iterations);
+
+        // Set the maximum number of threads, at most one per core, 0 for one per core.
+        void SetThreadCount (unsigned ThreadCount);
+
+        // Set the job system solving the colours, 0 to solve them on the calling thread. The job system is not copied.
+        void SetJobSystem (CJobSystem *Jobs);
+
+        // Return the number of passes over the links.
+        unsigned GetIterations () const;
+
+        // Return the maximum number of threads.
+        unsigned GetThreadCount () const;
+
+        // Remove every link.
+        void Clear ();
+
+        // Add a link of Length between the bodies A and B, Stiffness (N/m for a ball of 1 kg) 0 for a rod. Return its index.
+        unsigned AddLink (unsigned A, unsigned B, float Length, float Stiffness);
+
+        // Add a link of Length between the body A and the fixed point (X, Y). Return its index.
+        unsigned AddAnchor (unsigned A, float X, float Y, float Length, float Stiffness);
+
+        // Remove the links of a body, the indexes of the other links may change.
+        void RemoveBody (unsigned Body);
+
+        // Return the number of links.
+        unsigned GetLinkCount () const;
+
+        // Give the bodies of a link, B is LINK_ANCHOR for a fixed point.
+        void GetLink (unsigned Link, unsigned &A, unsigned &B) const;
+
+        // Return the number of colours of the links.
+        unsigned GetColourCount () const;
+
+        // Move the balls to the lengths of the links and change their velocities as much, during a step of TimeStep.
+        // Slots gives the place of each body in the arrays, the links between two bodies placed from ActiveCount are not solved.
+        void Solve (const unsigned *Slots, unsigned ActiveCount, float *PosX, float *PosY, float *VelX, float *VelY, float TimeStep);
+
+    private :
+
+        // Store a link.
+        struct Link
+        {
+            unsigned A;                 // the first body.
+            unsigned B;                 // the second body or LINK_ANCHOR.
+            float X;                    // the fixed point of an anchor.
+            float Y;
+            float Length;               // the length to keep.
+            float Compliance;           // the inverse of the stiffness, 0 for a rod.
+        };
+
+        // Store the state of a link during a solve.
+        struct State
+        {
+            unsigned SlotA;             // the place of the bodies in the arrays.
+            unsigned SlotB;
+            float WeightA;              // 1 for an active body, 0 for a sleeping one or an anchor, that are not moved.
+            float WeightB;
+            float Lambda;               // the accumulated correction, divided by the compliance it gives the force of a spring.
+        };
+
+        // Sort the links by colours, the smallest colour not used by the bodies of a link is given to it.
+        void Colour ();
+
+        // Solve the links of a colour, split into PartNumber parts.
+        void SolveColour (unsigned Colour, unsigned PartNumber);
+
+        // Solve a link.
+        void SolveLink (unsigned Link);
+
+        // Number of passes over the links and maximum number of threads.
+        unsigned m_Iterations;
+        unsigned m_ThreadCount;
+
+        // Job system solving the colours, 0 for none.
+        CJobSystem *m_Jobs;
+
+        // Links in the order of their addition.
+        std::vector <Link> m_Links;
+
+        // Links sorted by colours, with the index of the first one of each colour, and their states during a solve.
+        bool m_Coloured;
+        std::vector <Link> m_Sorted;
+        std::vector <unsigned> m_ColourStart;
+        std::vector <State> m_States;
+
+        // Tells if the last colour holds the links left over by the others, to be solved one after the other by a single thread.
+        bool m_Overflow;
+
+        // Arrays of the bodies during a solve.
+        float *m_PosX;
+        float *m_PosY;
+        float *m_VelX;
+        float *m_VelY;
+        float m_TimeStep;
+};
+#endif // __CLINKSOLVER_H__
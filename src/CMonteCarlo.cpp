@@ -0,0 +1,222 @@
+/**
+ *
+ * @file CMonteCarlo.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CMonteCarlo source file.
+ *
+ * @details Contain the implementation of the class CMonteCarlo.
+ *
+ * @see CMonteCarlo.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <thread>       // std::thread
+#include <functional>   // std::function
+#include <algorithm>    // std::min, std::max
+
+#include "CMonteCarlo.h"    // Class header
+#include "CTrajectory.h"    // Closed form of the trajectory
+#include "CBlockRunner.h"   // Blocks of samples
+#include "random.h"         // Philox, UniformComputing, NormalComputing
+#include "common.h"         // Settings struct, BallState struct, ARENA sizes
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Largest number of bins of the histogram of the bounces, one per number of bounces under it.
+    const unsigned MaxBounceBins = 1000;
+
+    // Highest coefficient of restitution drawn, the bounces have to lose energy to end.
+    const float MaxRestitutionCoef = 0.99;
+}
+
+// Initialize a study of the parameters without any randomness.
+CMonteCarlo::CMonteCarlo (const Settings &Parameters, double Time, unsigned long long Seed/* = 0*/) : m_Parameters (Parameters), m_Time (Time),
+                                                                                                       m_BinCount (20), m_ThreadCount (1)
+{
+    m_Key [0] = (unsigned) Seed;
+    m_Key [1] = (unsigned) (Seed >> 32);
+
+    for (unsigned i = 0; i < FIELD_COUNT; ++i)
+    {
+        m_Laws [i].Kind = FIXED;
+        m_Laws [i].A = 0;
+        m_Laws [i].B = 0;
+    }
+
+    SetThreadCount (0);
+
+}// CMonteCarlo ()
+
+// Set the law of a field.
+void CMonteCarlo::SetDistribution (Field Drawn, const Distribution &Law)
+{
+    m_Laws [Drawn] = Law;
+
+}// SetDistribution ()
+
+// Set the number of bins of the histograms.
+void CMonteCarlo::SetBinCount (unsigned BinCount)
+{
+    m_BinCount = max (BinCount, 1u);
+
+}// SetBinCount ()
+
+// Set the maximum number of threads, 0 for one per core.
+void CMonteCarlo::SetThreadCount (unsigned ThreadCount)
+{
+    // The number of cores may be unknown.
+    if (ThreadCount == 0)
+        ThreadCount = thread::hardware_concurrency ();
+
+    m_ThreadCount = max (ThreadCount, 1u);
+
+}// SetThreadCount ()
+
+// Set the function called after each round of blocks.
+void CMonteCarlo::SetProgress (const function <void (const Report &)> &Progress)
+{
+    m_Progress = Progress;
+
+}// SetProgress ()
+
+// Return the settings of a sample.
+Settings CMonteCarlo::GetSample (unsigned long long Sample) const
+{
+    float Values [FIELD_COUNT] = {m_Parameters.Speed, m_Parameters.Angle, m_Parameters.InitPos, m_Parameters.Gravity, m_Parameters.RestitutionCoef};
+
+    // Each field has its own block of the stream : the value of a field does not depend on the laws of the other ones.
+    for (unsigned i = 0; i < FIELD_COUNT; ++i)
+    {
+        if (m_Laws [i].Kind == FIXED)
+            continue;
+
+        unsigned Counter [4] = {(unsigned) Sample, (unsigned) (Sample >> 32), i, 0};
+        Philox (Counter, m_Key);
+
+        if (m_Laws [i].Kind == UNIFORM)
+            Values [i] = m_Laws [i].A + (m_Laws [i].B - m_Laws [i].A) * UniformComputing (Counter [0]);
+        else
+            Values [i] = m_Laws [i].A + m_Laws [i].B * NormalComputing (Counter [0], Counter [1]);
+    }
+
+    Settings Parameters = m_Parameters;
+    Parameters.Speed = max (Values [SPEED], 0.0f);
+    Parameters.Angle = Values [ANGLE];
+    Parameters.InitPos = min (max (Values [INIT_POS], 0.0f), (float) ARENA_HEIGHT);
+    Parameters.Gravity = max (Values [GRAVITY], 0.0f);
+    Parameters.RestitutionCoef = min (max (Values [RESTITUTION_COEF], 0.0f), MaxRestitutionCoef);
+    Parameters.Time = 0;
+    Parameters.TotalTime = 0;
+    Parameters.Dir = LEFTTORIGHT;
+
+    return Parameters;
+
+}// GetSample ()
+
+// Run the samples and sum up their outcomes.
+void CMonteCarlo::Run (unsigned long long SampleCount, Report &Result) const
+{
+    CBlockRunner Runner (SampleCount, m_ThreadCount);
+
+    /* BOUNDS OF THE HISTOGRAMS */
+    vector <Outcome> Pilot (Runner.GetPilotCount ());
+    Runner.RunPilot ([this, &Pilot] (unsigned Sample, unsigned long long Item)
+    {
+        Evaluate (Item, Pilot [Sample]);
+    });
+
+    Report Bounds;
+    Bounds.Samples = 0;
+    for (unsigned i = 0; i < Pilot.size (); ++i)
+        Add (Bounds, Pilot [i]);
+
+    Report Empty;
+    Empty.Samples = 0;
+    Empty.LandingX = Bounds.LandingX.GetCovering (m_BinCount);
+    Empty.LandingTime = Bounds.LandingTime.GetCovering (m_BinCount);
+    Empty.RestTime = Bounds.RestTime.GetCovering (m_BinCount);
+    Empty.Bounces = Bounds.Bounces.GetCovering (MaxBounceBins, true);
+
+    /* SAMPLES, ROUND AFTER ROUND */
+    Result = Empty;
+    vector <Report> Blocks (ROUND_BLOCKS, Empty);
+
+    Runner.RunBlocks ([&] (unsigned Slot, unsigned long long Begin, unsigned long long End)
+    {
+        Report &Block = Blocks [Slot];
+        Block.Samples = 0;
+        Block.LandingX.Clear ();
+        Block.LandingTime.Clear ();
+        Block.RestTime.Clear ();
+        Block.Bounces.Clear ();
+
+        // The samples of the pilot are not run again.
+        for (unsigned long long Sample = Begin; Sample < End; ++Sample)
+        {
+            unsigned Place = Runner.FindPilot (Sample);
+            if (Place != NO_PILOT)
+                Add (Block, Pilot [Place]);
+            else
+            {
+                Outcome Current;
+                Evaluate (Sample, Current);
+                Add (Block, Current);
+            }
+        }
+    },
+    [&] (unsigned Slot)
+    {
+        Result.Samples += Blocks [Slot].Samples;
+        Result.LandingX.Merge (Blocks [Slot].LandingX);
+        Result.LandingTime.Merge (Blocks [Slot].LandingTime);
+        Result.RestTime.Merge (Blocks [Slot].RestTime);
+        Result.Bounces.Merge (Blocks [Slot].Bounces);
+    },
+    [&] ()
+    {
+        if (m_Progress)
+            m_Progress (Result);
+    });
+
+}// Run ()
+
+// Compute the outcomes of a sample.
+void CMonteCarlo::Evaluate (unsigned long long Sample, Outcome &Current) const
+{
+    CTrajectory Trajectory (GetSample (Sample));
+
+    Current.LandingTime = Trajectory.GetLandingTime ();
+    Current.LandingX = Current.LandingTime <= m_Time ? Trajectory.GetState (Current.LandingTime).X : 0;
+    Current.RestTime = Trajectory.GetRestTime ();
+    Current.Bounces = Trajectory.GetState (m_Time).Bounces;
+
+}// Evaluate ()
+
+// Add the outcomes of a sample.
+void CMonteCarlo::Add (Report &Total, const Outcome &Current) const
+{
+    ++Total.Samples;
+
+    // The balls landing or resting after the time of the study are left out of the distributions.
+    if (Current.LandingTime <= m_Time)
+    {
+        Total.LandingX.Add (Current.LandingX);
+        Total.LandingTime.Add (Current.LandingTime);
+    }
+
+    if (Current.RestTime <= m_Time)
+        Total.RestTime.Add (Current.RestTime);
+
+    Total.Bounces.Add (Current.Bounces);
+
+}// Add ()
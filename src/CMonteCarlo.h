@@ -0,0 +1,119 @@
+/**
+ *
+ * @file CMonteCarlo.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CMonteCarlo header file.
+ *
+ * @details Contain declaration of the class CMonteCarlo, which launches many balls with settings drawn from laws
+ *          around the given ones, and gives the distributions of the points and times of landing and of the times
+ *          to rest. The settings of the sample i are drawn by the counter-based generator Philox from the counter i
+ *          and the seed : they do not depend on the threads. The samples are summed up by blocks, the blocks are run
+ *          by rounds on a job system, and merged in their order after each round : the report is the same whatever
+ *          the number of threads, and the report of the samples already run is given after each round.
+ *          The histograms cover the values of the first samples, computed before the other ones.
+ *
+ * @see CMonteCarlo.cpp
+ *
+ **/
+
+#ifndef __CMONTECARLO_H__
+#define __CMONTECARLO_H__
+
+#include <functional>   // std::function
+
+#include "common.h"         // Settings struct
+#include "CStatistics.h"    // Distribution of an outcome
+
+/*
+** CMonteCarlo class that gives the distributions of the outcomes of settings drawn at random, on every core.
+*/
+class CMonteCarlo
+{
+    public :
+
+        // The drawn fields of the settings.
+        typedef enum{SPEED, ANGLE, INIT_POS, GRAVITY, RESTITUTION_COEF, FIELD_COUNT} Field;
+
+        // The laws of the fields.
+        typedef enum{FIXED, UNIFORM, NORMAL} Law;
+
+        // Store the law of a field.
+        struct Distribution
+        {
+            Law Kind;                   // the law.
+            float A;                    // the lower bound, or the mean of the normal law.
+            float B;                    // the upper bound, or the standard deviation of the normal law.
+        };
+
+        // Store the distributions of a study.
+        struct Report
+        {
+            unsigned long long Samples; // the number of samples.
+            CStatistics LandingX;       // the abscissa of the first impact on the floor.
+            CStatistics LandingTime;    // the time of the first impact on the floor.
+            CStatistics RestTime;       // the time the ball starts sliding on the floor, for the ones before the time of the study.
+            CStatistics Bounces;        // the number of bounces at the time of the study.
+        };
+
+        // Initialize a study of the parameters without any randomness, until the time Time, with one thread per core.
+        CMonteCarlo (const nsTools::Settings &Parameters, double Time, unsigned long long Seed = 0);
+
+        // Set the law of a field. A value drawn out of the domain of its field is brought back to its closest bound.
+        void SetDistribution (Field Drawn, const Distribution &Law);
+
+        // Set the number of bins of the histograms.
+        void SetBinCount (unsigned BinCount);
+
+        // Set the maximum number of threads, 0 for one per core.
+        void SetThreadCount (unsigned ThreadCount);
+
+        // Set the function called with the report of the samples already run, after each round of blocks. Empty for none.
+        void SetProgress (const std::function <void (const Report &)> &Progress);
+
+        // Return the settings of the sample Sample.
+        nsTools::Settings GetSample (unsigned long long Sample) const;
+
+        // Run SampleCount samples and sum up their outcomes.
+        void Run (unsigned long long SampleCount, Report &Result) const;
+
+    private :
+
+        // Store the outcomes of a sample.
+        struct Outcome
+        {
+            double LandingX;            // the abscissa of the first impact on the floor, 0 if it is after the time of the study.
+            double LandingTime;         // the time of the first impact on the floor.
+            double RestTime;            // the time the ball starts sliding on the floor.
+            unsigned Bounces;           // the number of bounces at the time of the study.
+        };
+
+        // Compute the outcomes of a sample.
+        void Evaluate (unsigned long long Sample, Outcome &Current) const;
+
+        // Add the outcomes of a sample to a report.
+        void Add (Report &Total, const Outcome &Current) const;
+
+        // Parameters of the fixed fields, time of the study and key of the generator.
+        nsTools::Settings m_Parameters;
+        double m_Time;
+        unsigned m_Key [2];
+
+        // Law of each field.
+        Distribution m_Laws [FIELD_COUNT];
+
+        // Number of bins of the histograms.
+        unsigned m_BinCount;
+
+        // Maximum number of threads.
+        unsigned m_ThreadCount;
+
+        // Function called after each round.
+        std::function <void (const Report &)> m_Progress;
+};
+#endif // __CMONTECARLO_H__
@@ -0,0 +1,281 @@
+/**
+ *
+ * @file CPegBoard.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CPegBoard source file.
+ *
+ * @details Contain the implementation of the class CPegBoard.
+ *
+ * @see CPegBoard.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <string>       // std::string, std::getline
+#include <fstream>      // std::ifstream
+#include <sstream>      // std::istringstream
+#include <algorithm>    // std::min, std::max
+#include <math.h>       // sqrt
+
+#include "CPegBoard.h"  // Class header
+#include "CGrid.h"      // Uniform grid
+#include "physics.h"    // ContactComputing, ImpactComputing, reflections
+#include "common.h"     // ARENA_WIDTH, ARENA_HEIGHT, COLLISION codes, REST_FLIGHT_TIME, SURFACE_SKIN
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Maximum number of impacts of a drop, a ball held on the top of a peg never falls.
+    const unsigned MaxEvents = 10000;
+}
+
+// Initialize a board without any peg, for a point ball.
+CPegBoard::CPegBoard () : m_MaxRadius (0), m_BallRadius (0), m_CellSize (1)
+{
+
+}// CPegBoard ()
+
+// Remove every peg.
+void CPegBoard::Clear ()
+{
+    m_X.clear ();
+    m_Y.clear ();
+    m_Radius.clear ();
+    m_RestitutionCoef.clear ();
+    m_MaxRadius = 0;
+
+}// Clear ()
+
+// Add a peg centered on (X, Y) inside the arena, return its index.
+unsigned CPegBoard::AddPeg (float X, float Y, float Radius, float RestitutionCoef/* = -1*/)
+{
+    m_X.push_back (X);
+    m_Y.push_back (Y);
+    m_Radius.push_back (Radius);
+    m_RestitutionCoef.push_back (RestitutionCoef);
+    m_MaxRadius = max (m_MaxRadius, Radius);
+
+    return m_X.size () - 1;
+
+}// AddPeg ()
+
+// Read the pegs of a file, one "X Y Radius [RestitutionCoef]" per line.
+bool CPegBoard::Load (const char *FileName)
+{
+    ifstream File (FileName);
+    if (! File)
+        return false;
+
+    string Line;
+    while (getline (File, Line))
+    {
+        // Remove the comment.
+        string::size_type Comment = Line.find ('#');
+        if (Comment != string::npos)
+            Line.erase (Comment);
+
+        istringstream Values (Line);
+        float X;
+        float Y;
+        float Radius;
+        float RestitutionCoef = -1;
+
+        // Empty line.
+        if (! (Values >> X))
+            continue;
+
+        // The grid only covers the arena.
+        if (! (Values >> Y >> Radius) || X < 0 || X > ARENA_WIDTH || Y < 0 || Y > ARENA_HEIGHT)
+            return false;
+
+        if (! (Values >> RestitutionCoef))
+            RestitutionCoef = -1;
+
+        AddPeg (X, Y, Radius, RestitutionCoef);
+    }
+
+    Build ();
+
+    return true;
+
+}// Load ()
+
+// Set the radius of the balls.
+void CPegBoard::SetBallRadius (float Radius)
+{
+    m_BallRadius = Radius;
+
+}// SetBallRadius ()
+
+// Sort the pegs by cells.
+void CPegBoard::Build ()
+{
+    // A cell holds about one peg, and is at least as large as a contact.
+    float Reach = m_MaxRadius + m_BallRadius;
+    m_CellSize = max (2 * Reach, (float) sqrt (ARENA_WIDTH * ARENA_HEIGHT / (double) max (m_X.size (), (size_t) 1)));
+
+    m_Grid.Build (m_X.data (), m_Y.data (), m_X.size (), m_CellSize);
+
+}// Build ()
+
+// Return the number of pegs.
+unsigned CPegBoard::GetPegCount () const
+{
+    return m_X.size ();
+
+}// GetPegCount ()
+
+// Find the first peg touched before MaxTime by the ball.
+bool CPegBoard::FirstImpact (double X, double Y, double VelX, double VelY, double Gravity, double MaxTime, Impact &First) const
+{
+    if (m_X.empty ())
+        return false;
+
+    double Reach = m_MaxRadius + m_BallRadius;
+    bool Found = false;
+
+    // The arc is cut in pieces of about one cell, the pegs around each piece are tested until an impact is found before its end.
+    double Start = 0;
+    while (Start < MaxTime)
+    {
+        /* PIECE OF THE ARC */
+        double StartX = X + VelX * Start;
+        double StartY = Y + (VelY - 0.5 * Gravity * Start) * Start;
+        double StartVelY = VelY - Gravity * Start;
+        double Speed = sqrt (VelX * VelX + StartVelY * StartVelY);
+
+        // Time to go through a cell : Speed * t + Gravity * t * t / 2 = m_CellSize.
+        double Length;
+        if (Gravity > 0)
+            Length = (sqrt (Speed * Speed + 2 * Gravity * m_CellSize) - Speed) / Gravity;
+        else
+            Length = Speed > 0 ? m_CellSize / Speed : MaxTime - Start;
+
+        double End = min (MaxTime, Start + Length);
+        double Duration = End - Start;
+
+        double EndX = StartX + VelX * Duration;
+        double EndY = StartY + (StartVelY - 0.5 * Gravity * Duration) * Duration;
+        double MinY = min (StartY, EndY);
+        double MaxY = max (StartY, EndY);
+
+        // The top of the parabola is reached during the piece.
+        if (Gravity > 0 && StartVelY > 0 && StartVelY < Gravity * Duration)
+            MaxY = StartY + 0.5 * StartVelY * StartVelY / Gravity;
+
+        /* PEGS OF THE CELLS AROUND THE PIECE */
+        unsigned FirstColumn = m_Grid.GetColumn (min (StartX, EndX) - Reach);
+        unsigned LastColumn = m_Grid.GetColumn (max (StartX, EndX) + Reach);
+        unsigned FirstRow = m_Grid.GetRow (MinY - Reach);
+        unsigned LastRow = m_Grid.GetRow (MaxY + Reach);
+
+        for (unsigned j = FirstRow; j <= LastRow; ++j)
+            for (unsigned i = FirstColumn; i <= LastColumn; ++i)
+            {
+                const unsigned *Begin;
+                const unsigned *Last;
+                m_Grid.GetCell (i, j, Begin, Last);
+
+                for (const unsigned *Peg = Begin; Peg != Last; ++Peg)
+                {
+                    // Most pegs of the cells are too far from the piece to be touched during it.
+                    float Contact = m_Radius [*Peg] + m_BallRadius;
+                    if (m_X [*Peg] + Contact < min (StartX, EndX) || m_X [*Peg] - Contact > max (StartX, EndX) ||
+                        m_Y [*Peg] + Contact < MinY || m_Y [*Peg] - Contact > MaxY)
+                        continue;
+
+                    // The peg does not move, the relative acceleration is the opposite of the one of the ball.
+                    double Time = ContactComputing (m_X [*Peg] - X, m_Y [*Peg] - Y, -VelX, -VelY, 0, Gravity, Contact);
+
+                    if (Time < 0 || Time > MaxTime)
+                        continue;
+
+                    double DX = X + VelX * Time - m_X [*Peg];
+                    double DY = Y + (VelY - 0.5 * Gravity * Time) * Time - m_Y [*Peg];
+                    double Distance = sqrt (DX * DX + DY * DY);
+
+                    if (Distance <= 0)
+                        continue;
+
+                    // The next pieces only look for earlier impacts.
+                    MaxTime = Time;
+                    First.Time = Time;
+                    First.NX = DX / Distance;
+                    First.NY = DY / Distance;
+                    First.RestitutionCoef = m_RestitutionCoef [*Peg];
+                    First.Peg = *Peg;
+                    Found = true;
+                }
+            }
+
+        Start = End;
+    }
+
+    return Found;
+
+}// FirstImpact ()
+
+// Drop a ball from (X, Y) until it touches the floor.
+bool CPegBoard::Drop (double X, double Y, double VelX, double VelY, double Gravity, double RestitutionCoef, double &LandingX, unsigned &Bounces) const
+{
+    Bounces = 0;
+
+    for (unsigned Event = 0; Event < MaxEvents; ++Event)
+    {
+        // The arena bounds the trajectory, the pegs are only looked for before it.
+        unsigned Code;
+        double Time = ImpactComputing (X, Y, VelX, VelY, Gravity, Code);
+        if (Time < 0)
+            return false;
+
+        Impact First;
+        bool OnPeg = FirstImpact (X, Y, VelX, VelY, Gravity, Time, First);
+        if (OnPeg)
+            Time = First.Time;
+
+        // Move to the impact.
+        X += VelX * Time;
+        Y += (VelY - 0.5 * Gravity * Time) * Time;
+        float NewVelX = VelX;
+        float NewVelY = VelY - Gravity * Time;
+
+        if (! OnPeg)
+        {
+            if (Code & COLLISION_BOTTOM)
+            {
+                LandingX = X;
+                return true;
+            }
+
+            Bounces += ReflectionComputing (NewVelX, NewVelY, Code, RestitutionCoef);
+
+            pair <float, float> Clamped = ClampComputing (make_pair ((float) X, (float) Y));
+            X = Clamped.first;
+            Y = Clamped.second;
+        }
+        else
+        {
+            // Too short a flight off the peg makes the ball roll around it, the next impacts follow each other closely.
+            float Coef = First.RestitutionCoef < 0 ? RestitutionCoef : First.RestitutionCoef;
+            if (SurfaceReflectionComputing (NewVelX, NewVelY, First.NX, First.NY, Coef, Gravity, REST_FLIGHT_TIME))
+                ++Bounces;
+
+            X += SURFACE_SKIN * First.NX;
+            Y += SURFACE_SKIN * First.NY;
+        }
+
+        VelX = NewVelX;
+        VelY = NewVelY;
+    }
+
+    return false;
+
+}// Drop ()
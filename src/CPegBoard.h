@@ -0,0 +1,92 @@
+/**
+ *
+ * @file CPegBoard.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CPegBoard header file.
+ *
+ * @details Contain declaration of the class CPegBoard, a field of fixed circular pegs the ball falls through (Galton board).
+ *          The pegs are sorted by cells of a uniform grid : the ball only tests the pegs of the cells along its arc,
+ *          and jumps from one impact to the next one, computed exactly on the parabola.
+ *
+ * @see CPegBoard.cpp
+ *
+ **/
+
+#ifndef __CPEGBOARD_H__
+#define __CPEGBOARD_H__
+
+#include <vector>       // std::vector
+
+#include "CGrid.h"      // Uniform grid
+
+/*
+** CPegBoard class that drops balls through a field of pegs.
+*/
+class CPegBoard
+{
+    public :
+
+        // Store the first impact of a ball on a peg.
+        struct Impact
+        {
+            double Time;                // the time of the impact.
+            float NX;                   // the normal going from the peg toward the ball.
+            float NY;
+            float RestitutionCoef;      // the coefficient of the peg, negative to use the one of the ball.
+            unsigned Peg;               // the index of the peg.
+        };
+
+        // Initialize a board without any peg, for a point ball.
+        CPegBoard ();
+
+        // Remove every peg.
+        void Clear ();
+
+        // Add a peg centered on (X, Y) inside the arena, RestitutionCoef negative to use the one of the ball. Return its index.
+        unsigned AddPeg (float X, float Y, float Radius, float RestitutionCoef = -1);
+
+        // Read the pegs of a file, one "X Y Radius [RestitutionCoef]" per line, '#' starts a comment.
+        // Return false if the file can not be read or a line is wrong.
+        bool Load (const char *FileName);
+
+        // Set the radius of the balls.
+        void SetBallRadius (float Radius);
+
+        // Sort the pegs by cells, to call after the last AddPeg () or SetBallRadius ().
+        void Build ();
+
+        // Return the number of pegs.
+        unsigned GetPegCount () const;
+
+        // Find the first peg touched before MaxTime by the ball at (X, Y) with the velocity (VelX, VelY) and falling with Gravity.
+        // Return false if there is none.
+        bool FirstImpact (double X, double Y, double VelX, double VelY, double Gravity, double MaxTime, Impact &First) const;
+
+        // Drop a ball from (X, Y) until it touches the floor, it bounces on the pegs, the walls and the roof.
+        // LandingX receives the abscissa where it touches the floor, Bounces the number of bounces.
+        // Return false if the ball never reaches the floor, held on a peg or without gravity.
+        bool Drop (double X, double Y, double VelX, double VelY, double Gravity, double RestitutionCoef, double &LandingX, unsigned &Bounces) const;
+
+    private :
+
+        // Center, radius and coefficient of restitution of the pegs.
+        std::vector <float> m_X;
+        std::vector <float> m_Y;
+        std::vector <float> m_Radius;
+        std::vector <float> m_RestitutionCoef;
+
+        // Radius of the largest peg and of the balls.
+        float m_MaxRadius;
+        float m_BallRadius;
+
+        // Grid of the centers of the pegs.
+        float m_CellSize;
+        CGrid m_Grid;
+};
+#endif // __CPEGBOARD_H__
@@ -22,7 +22,6 @@
 #include <iostream>     // std::cout
 #include <utility>      // std::pair
 #include <vector>       // std::vector
-#include <ctime>        // std::time
 
 /* GLEW INCLUDES START */
 #include <glm/glm.hpp>
@@ -36,13 +35,17 @@
 #include "common.h"         // Settings structure
 #include "CGrad.h"          // CGrad class
 #include "CBall.h"          // CBall class
+#include "CSimulation.h"    // CSimulation class
+#include "CJobSystem.h"     // CJobSystem class
+#include "random.h"         // Philox
 
 
 using namespace glm;
 
 // Initialize the CSceneOpenGl class that contains them main part of the program.
 CSceneOpenGL::CSceneOpenGL (std::string WindowTitle, int WindowWidth, int WindowHeight) : m_WindowTitle (WindowTitle), m_WindowWidth (WindowWidth),
-                                                                                          m_WindowHeight (WindowHeight), m_Window (0), m_OpenGlContext (0)
+                                                                                          m_WindowHeight (WindowHeight), m_Window (0), m_OpenGlContext (0),
+                                                                                          m_VerticalSync (false)
 {
 
 }
@@ -148,6 +151,11 @@ bool CSceneOpenGL::InitGL ()
     // Enable depth field.
     glEnable (GL_DEPTH_TEST);
 
+    // Synchronize the buffer swap with the display refresh rate, some drivers refuse it.
+    m_VerticalSync = SDL_GL_SetSwapInterval (1) == 0;
+    if (! m_VerticalSync)
+        std::cout << "Synchronisation verticale indisponible : " << SDL_GetError () << std::endl;
+
     return true;
 }
 
@@ -157,17 +165,19 @@ void CSceneOpenGL::MainLoop ()
     // Set the variable to true to enter activate the infinite loop.
     bool Exit = false;
 
-    // Tells the iteration number of the loop.
-    unsigned Iter = 0;
+    // Physics step (1 ms, 1 kHz), the frame rate only depends on the display.
+    const float PhysicsStep = 0.001;
+
+    // Shortest frame (ms) when the buffer swap does not wait for the display, or when nothing is drawn (60 FPS).
+    const Uint32 FrameTime = 1000 / 60;
 
-    // Set framerate (change the second number to set it : 1000/50 = 50 FPS.
-    unsigned int FPS = 50;
-    unsigned int FrameRate (1000 / FPS);
+    // Jobs of the frame, and number of vertices of the ball moved by each of them.
+    CJobSystem Jobs;
+    const unsigned VerticesPerJob = 4096;
 
-    // Manage framerate.
-    Uint32 LoopBeginning (0);
-    Uint32 LoopEnding (0);
-    Uint32 ElapsedTime (0);
+    // Manage wall-clock time.
+    Uint32 LastTicks (SDL_GetTicks ());
+    Uint32 LastDisplay (LastTicks);
 
     // Create the struct that contains trajectory variables.
     struct nsTools::Settings Settings;
@@ -184,13 +194,8 @@ void CSceneOpenGL::MainLoop ()
     // Ask the user to enter his parameters to create the simulation
     Settings = nsTools::SetParameters ();
 
-    // Set the last parameters.
-    Settings.Time = 0;
-    Settings.TotalTime = 0;
-    Settings.Dir = nsTools::LEFTTORIGHT;
-
-    // Save settings to start again.
-    struct nsTools::Settings SaveSettings = Settings;
+    // Create the headless simulation engine, it saves the settings to start again.
+    CSimulation Simulation (Settings);
 
     // Create the ball.
     CBall Ball (Settings);
@@ -202,13 +207,15 @@ void CSceneOpenGL::MainLoop ()
     float vertices [ArraySize];
     float couleurs [ArraySize];
 
-    // Initialize random seed.
-    srand (time (NULL));
+    // The colours are drawn by the counter-based generator, the same at each launch.
+    const unsigned ColourKey [2] = {0, 0};
 
     // Get the vertex of the ball.
     for (unsigned i = 0; i < ArraySize; ++i)
     {
-        float RandomNumber = rand() % 255;
+        unsigned Counter [4] = {i, 0, 0, 0};
+        nsTools::Philox (Counter, ColourKey);
+        float RandomNumber = Counter [0] % 255;
         vertices [i] = VerticesTemps [i];
         couleurs [i] = RandomNumber / 255.0;
     }
@@ -227,22 +234,13 @@ void CSceneOpenGL::MainLoop ()
     // Set the  first camera settings.
     Modelview = lookAt (vec3 (1, 1, 1), vec3 (0, 0, 0), vec3 (0, 1, 0));
 
-    // To manage collision on X axis.
-    float OldX = 0.0;
-
-    // Old an new point (center of our ball).
-    std::pair <float, float> Old;
-    std::pair <float, float> New;
-
-    // Tells if it the first time running the loop.
-    bool FirstLoop = true;
+    // Last computed point and point where the ball is drawn (the vertices are centered on (0, 0) when created).
+    std::pair <float, float> New = Simulation.GetNewPosition ();
+    std::pair <float, float> Drawn (0, 0);
 
     // Manage is simulation is pause or not.
     bool Paused = false;
 
-     // Get the current angle to manage speed variation.
-    float CurrentAngle = 0;
-
     // Set the position of the camera.
     float PosCam[3] = {38.4, 26.8, 41};
     float LookAtPos[3] = {PosCam[0], PosCam[1], 0};
@@ -250,8 +248,8 @@ void CSceneOpenGL::MainLoop ()
 
     while (! Exit)
     {
-        //Get the tick at loop beginning.
-        LoopBeginning = SDL_GetTicks ();
+        // Get the tick at loop beginning.
+        Uint32 FrameBeginning = SDL_GetTicks ();
 
         /*
         ** EVENT MANAGEMENT
@@ -271,13 +269,10 @@ void CSceneOpenGL::MainLoop ()
                 if (Paused)
                 {
                     // If object stopped, restart the simulation
-                    if (Settings.Speed < 0.000001)
+                    if (Simulation.IsStopped ())
                     {
                         // Set back the attributes at their initial position.
-                        FirstLoop = true;
-                        Settings = SaveSettings;
-                        OldX = 0.0;
-                        Iter = 0;
+                        Simulation.Reset ();
 
                         // Puts the camera back to her initial position.
                         PosCam[0] = 38.4;
@@ -289,19 +284,17 @@ void CSceneOpenGL::MainLoop ()
                         CamAngle[0] = false;
                         CamAngle[1] = false;
                         CamAngle[2] = false;
-
-                        // Puts the ball back to the first position
-                        nsTools::Translate (vertices, ArraySize, Old, std::make_pair (0, 0), 0.0);
                     }
 
-                    DisplayInformation (Settings, CurrentAngle, New);
+                    DisplayInformation (Simulation.GetSettings (), Simulation.GetCurrentAngle (), New);
 
-                    // Restart
+                    // Restart, the time spent in pause is not simulated.
                     Paused = false;
+                    LastTicks = SDL_GetTicks ();
                 }
                 else
                 {
-                    DisplayInformation (Settings, CurrentAngle, New);
+                    DisplayInformation (Simulation.GetSettings (), Simulation.GetCurrentAngle (), New);
                     std::cout << std::endl << "Simulation en pause." << std::endl;
                     Paused = true;
                 }
@@ -516,180 +509,31 @@ void CSceneOpenGL::MainLoop ()
         // If user didn't paused the simulation.
         if (! Paused)
         {
-            // Set the total time of the simulation
-            Settings.TotalTime += 1.0 / (float) FPS;
-
             /*
             ** TRAJECTORY COMPUTING
-            ** CONTAIN ANGLE COMPUTING, COLLISION DETECTION AND TRAJECTORY ANALYSIS
-            ** START
+            ** DONE BY THE HEADLESS SIMULATION ENGINE, AS MANY FIXED STEPS AS THE WALL-CLOCK TIME REQUIRES
             */
+                Uint32 Ticks = SDL_GetTicks ();
+                Simulation.Advance ((Ticks - LastTicks) / 1000.0, PhysicsStep);
+                LastTicks = Ticks;
 
-                // If no one point were created.
-                if (FirstLoop)
-                    CurrentAngle = Settings.Angle;
-
-                // Else if we can create the vector with old and new point to get the angle.
-                else
-                    CurrentAngle = nsTools::AngleComputing (Old, New, false, Settings.Dir);
-
-
-                // Compute the point at t = t.
-                Old = nsTools::PositionComputing (Settings, OldX);
-
-                // Add time
-                Settings.Time += 1.0 / (float) FPS;
-
-                // Compute the point at t = t + 1 / FPS.
-                New = nsTools::PositionComputing (Settings, OldX);
-
-
-                /*
-                ** COLLISION DETECTION
-                ** START
-                */
-
-                    /* RIGHT WALL */
-                    if (nsTools::CollisionDetectionBorder (New.first) == 2)
-                    {
-                        /*
-                        ** COMPUTE THE NEW TRAJECTORY EVERY TIME THE BALL TOUCH A BORDER
-                        */
-
-                        // Compute the new speed of the ball.
-                        Settings.Speed =  Settings.Speed * Settings.RestitutionCoef;
+                New = Simulation.GetNewPosition ();
 
-                        // ANGLE COMPUTING //
-
-                        // If ball going down.
-                        if (New.second < Old.second)
-                            Settings.Angle = nsTools::AngleComputing (Old, New, true, nsTools::RIGHTTOLEFT) - PI;
-                        // If ball going up.
-                        else
-                            Settings.Angle = nsTools::AngleComputing (Old, New, true, nsTools::RIGHTTOLEFT);
-
-                        // ANGLE COMPUTING END //
-
-                        // Get the new initial position.
-                        Settings.InitPos = Old.second;
-
-                        // Reset time for the new trajectory.
-                        Settings.Time = 0;
-
-                        // We have to change direction, touched right border, then go to the left.
-                        Settings.Dir = nsTools::RIGHTTOLEFT;
-
-                        // X maximum value is the value just after touching the right wall.
-                        OldX = Old.first;
-                    }
-
-                    /* LEFT WALL */
-                    if (nsTools::CollisionDetectionBorder (New.first) == 1)
-                    {
-                        /*
-                        ** COMPUTE THE NEW TRAJECTORY EVERY TIME THE BALL TOUCH A BORDER
-                        */
-
-                        // ANGLE COMPUTING //
-
-                        // Compute the new speed of the ball.
-                        Settings.Speed =  Settings.Speed * Settings.RestitutionCoef;
-
-                        //If ball going down
-                        if (New.second < Old.second)
-                            Settings.Angle = nsTools::AngleComputing (Old, New, true, nsTools::LEFTTORIGHT) - PI;
-                        //If ball going up.
-                        else
-                            Settings.Angle = nsTools::AngleComputing (Old, New, true, nsTools::LEFTTORIGHT);
-
-                        // ANGLE COMPUTING END //
-
-                        // Get the new initial position.
-                        Settings.InitPos = Old.second;
-
-                        // Reset time for the new trajectory.
-                        Settings.Time = 0;
-
-                        // We have to change direction, touched left border, then go to the right.
-                        Settings.Dir = nsTools::LEFTTORIGHT;
-
-                        // X minimum value is the value just after touching the left wall.
-                        OldX = 0;
-                    }
-
-                    /* BOTTOM FLOOR */
-                    if (nsTools::CollisionDetectionBottomTop (New.second) == 1)
-                    {
-                        /*
-                        ** COMPUTE THE NEW TRAJECTORY EVERY TIME THE BALL TOUCH THE FLOOR
-                        */
-
-                        // Compute the new speed of the ball.
-                        Settings.Speed =  Settings.Speed * Settings.RestitutionCoef;
-
-                        // Get the new angle of the ball.
-                        Settings.Angle = nsTools::AngleComputing (Old, New, false, Settings.Dir);
-
-                        // Get the new initial position.
-                        Settings.InitPos = 0;
-
-                        // Reset time for the new trajectory.
-                        Settings.Time = 0;
-
-                        // Use OldX as last bouncing point to avoid the ball from doing strange things.
-                        OldX = New.first;
-                    }
-
-                    /* TOP ROOF */
-                    if (nsTools::CollisionDetectionBottomTop (New.second) == 2)
-                    {
-                        /*
-                        ** COMPUTE THE NEW TRAJECTORY EVERY TIME THE BALL TOUCH THE FLOOR
-                        */
-
-                        // Compute the new speed of the ball.
-                        Settings.Speed =  Settings.Speed * Settings.RestitutionCoef;
-
-                        // Get the new angle of the ball.
-                        Settings.Angle = -nsTools::AngleComputing (Old, New, false, Settings.Dir);
-
-                        // Get the new initial position.
-                        Settings.InitPos = Old.second;
-
-                        // Reset time for the new trajectory.
-                        Settings.Time = 0;
-
-                        // Use OldX as last bouncing point to avoid the ball from doing strange things.
-                        OldX = New.first;
-                    }
-
-                    // Compute the new point, just after bouncing on the floor.
-                    New = nsTools::PositionComputing (Settings, OldX);
-
-                /*
-                ** COLLISION DETECTION
-                ** END
-                */
-
-            /*
-            ** TRAJECTORY COMPUTING
-            ** CONTAIN ANGLE COMPUTING, COLLISION DETECTION AND TRAJECTORY ANALYSIS
-            ** END
-            */
+                // The ball is drawn between the two last physics states.
+                std::pair <float, float> Interpolated = Simulation.GetInterpolatedPosition ();
 
             /*
             ** DISPLAY OPENGL VIEW, PLACE POINTS AND MATRIX
             ** DISPLAY CONSOLE INFORMATION
             ** START
             */
-                // Translate the object
-                // If firstloop, put the object at the right place.
-                if (FirstLoop)
-                    nsTools::Translate (vertices, ArraySize, std::make_pair (0, 0), Old, 0.0);
-
-                // Else move it.
-                else
-                    nsTools::Translate (vertices, ArraySize, Old, New, 0.0);
+                // Translate the object from where it was drawn, by blocks of vertices on every core.
+                float *Vertices = vertices;
+                Jobs.ParallelFor (0, ArraySize / 3, VerticesPerJob, [&] (unsigned First, unsigned Last)
+                {
+                    nsTools::Translate (Vertices + 3 * First, 3 * (Last - First), Drawn, Interpolated, 0.0);
+                });
+                Drawn = Interpolated;
 
                 // Clear the window view and the depth buffer.
                 glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -777,10 +621,10 @@ void CSceneOpenGL::MainLoop ()
                 /* PRINT THE SIMULATION INFORMATION ON THE CONSOLE*/
 
                 // Display information every 3 seconds.
-                if (Iter % FPS * 300 == 0)
+                if (Ticks - LastDisplay >= 3000)
                 {
-                    Iter = 0;
-                    DisplayInformation (Settings, CurrentAngle, New);
+                    LastDisplay = Ticks;
+                    DisplayInformation (Simulation.GetSettings (), Simulation.GetCurrentAngle (), New);
                 }
 
 
@@ -789,31 +633,12 @@ void CSceneOpenGL::MainLoop ()
             ** DISPLAY CONSOLE INFORMATION
             ** END
             */
-
-            /*
-            ** FPS MANAGEMENT / MISC
-            ** START
-            */
-
-                // Get time elapsed during the current loop.
-                LoopEnding = SDL_GetTicks ();
-                ElapsedTime = LoopEnding - LoopBeginning;
-
-                // If too quick, wait.
-                if (ElapsedTime < FrameRate)
-                    SDL_Delay (FrameRate - ElapsedTime);
-
-                // If it was the first time looping
-                FirstLoop = false;
-
-                // Set iter ti iter + 1
-                ++Iter;
-
-            /*
-            ** FPS MANAGEMENT / MISC
-            ** START
-            */
         }
+
+        // Without vertical sync, or in pause, sleep until the next frame instead of spinning on a core.
+        Uint32 Spent = SDL_GetTicks () - FrameBeginning;
+        if ((Paused || ! m_VerticalSync) && Spent < FrameTime)
+            SDL_Delay (FrameTime - Spent);
     }
 
     // Simulation ended.
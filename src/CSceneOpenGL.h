@@ -81,5 +81,8 @@ class CSceneOpenGL
         // SDL event variable.
         SDL_Event  m_Event;
 
+        // Tells if the buffer swap waits for the display refresh, else the loop sleeps until the next frame.
+        bool m_VerticalSync;
+
 };
 #endif // __CSCENEOPENGL_H__
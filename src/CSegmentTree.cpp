@@ -0,0 +1,456 @@
+/**
+ *
+ * @file CSegmentTree.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CSegmentTree source file.
+ *
+ * @details Contain the implementation of the class CSegmentTree.
+ *
+ * @see CSegmentTree.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <string>       // std::string, std::getline
+#include <fstream>      // std::ifstream
+#include <sstream>      // std::istringstream
+#include <algorithm>    // std::min, std::max, std::nth_element
+#include <math.h>       // sqrt, fabs
+
+#include "CSegmentTree.h"   // Class header
+#include "physics.h"        // CrossingComputing, ContactComputing
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Maximum number of segments of a leaf.
+    const unsigned LeafSize = 4;
+
+    // Maximum depth of the hierarchy, the median split keeps it under log2 of the number of segments.
+    const unsigned MaxDepth = 64;
+}
+
+// Initialize a tree without any segment.
+CSegmentTree::CSegmentTree ()
+{
+
+}// CSegmentTree ()
+
+// Remove every segment.
+void CSegmentTree::Clear ()
+{
+    m_Segments.clear ();
+    m_Nodes.clear ();
+    m_Place.clear ();
+
+}// Clear ()
+
+// Add the segment from (X1, Y1) to (X2, Y2), return its index.
+unsigned CSegmentTree::AddSegment (float X1, float Y1, float X2, float Y2, float RestitutionCoef/* = -1*/)
+{
+    Segment New;
+    New.X1 = X1;
+    New.Y1 = Y1;
+    New.X2 = X2;
+    New.Y2 = Y2;
+    New.RestitutionCoef = RestitutionCoef;
+    New.Index = m_Segments.size ();
+
+    // Normal on the left of the segment, a segment reduced to a point has none.
+    float Length = sqrt ((X2 - X1) * (X2 - X1) + (Y2 - Y1) * (Y2 - Y1));
+    New.NX = Length > 0 ? (Y1 - Y2) / Length : 0;
+    New.NY = Length > 0 ? (X2 - X1) / Length : 0;
+
+    m_Segments.push_back (New);
+    m_Place.push_back (New.Index);
+
+    return New.Index;
+
+}// AddSegment ()
+
+// Read the segments of a file, one "X1 Y1 X2 Y2 [RestitutionCoef]" per line.
+bool CSegmentTree::Load (const char *FileName)
+{
+    ifstream File (FileName);
+    if (! File)
+        return false;
+
+    string Line;
+    while (getline (File, Line))
+    {
+        // Remove the comment.
+        string::size_type Comment = Line.find ('#');
+        if (Comment != string::npos)
+            Line.erase (Comment);
+
+        istringstream Values (Line);
+        float X1;
+        float Y1;
+        float X2;
+        float Y2;
+        float RestitutionCoef = -1;
+
+        // Empty line.
+        if (! (Values >> X1))
+            continue;
+
+        if (! (Values >> Y1 >> X2 >> Y2))
+            return false;
+
+        if (! (Values >> RestitutionCoef))
+            RestitutionCoef = -1;
+
+        AddSegment (X1, Y1, X2, Y2, RestitutionCoef);
+    }
+
+    Build ();
+
+    return true;
+
+}// Load ()
+
+// Build the hierarchy of the segments.
+void CSegmentTree::Build ()
+{
+    m_Nodes.clear ();
+    if (m_Segments.empty ())
+        return;
+
+    // A binary tree with leaves of LeafSize segments has less than 2 * N / LeafSize + 1 nodes.
+    m_Nodes.reserve (2 * m_Segments.size () / LeafSize + 2);
+    m_Nodes.resize (1);
+    BuildNode (0, 0, m_Segments.size ());
+
+    for (unsigned i = 0; i < m_Segments.size (); ++i)
+        m_Place [m_Segments [i].Index] = i;
+
+}// Build ()
+
+// Build the node of the segments between First and Last.
+void CSegmentTree::BuildNode (unsigned NodeIndex, unsigned First, unsigned Last)
+{
+    /* BOX OF THE SEGMENTS AND OF THEIR CENTERS */
+    float MinX = m_Segments [First].X1;
+    float MinY = m_Segments [First].Y1;
+    float MaxX = MinX;
+    float MaxY = MinY;
+    float CenterMinX = (m_Segments [First].X1 + m_Segments [First].X2) / 2;
+    float CenterMinY = (m_Segments [First].Y1 + m_Segments [First].Y2) / 2;
+    float CenterMaxX = CenterMinX;
+    float CenterMaxY = CenterMinY;
+
+    for (unsigned i = First; i < Last; ++i)
+    {
+        const Segment &Current = m_Segments [i];
+
+        MinX = min (MinX, min (Current.X1, Current.X2));
+        MinY = min (MinY, min (Current.Y1, Current.Y2));
+        MaxX = max (MaxX, max (Current.X1, Current.X2));
+        MaxY = max (MaxY, max (Current.Y1, Current.Y2));
+
+        float CenterX = (Current.X1 + Current.X2) / 2;
+        float CenterY = (Current.Y1 + Current.Y2) / 2;
+        CenterMinX = min (CenterMinX, CenterX);
+        CenterMinY = min (CenterMinY, CenterY);
+        CenterMaxX = max (CenterMaxX, CenterX);
+        CenterMaxY = max (CenterMaxY, CenterY);
+    }
+
+    m_Nodes [NodeIndex].MinX = MinX;
+    m_Nodes [NodeIndex].MinY = MinY;
+    m_Nodes [NodeIndex].MaxX = MaxX;
+    m_Nodes [NodeIndex].MaxY = MaxY;
+
+    /* LEAF */
+    if (Last - First <= LeafSize)
+    {
+        m_Nodes [NodeIndex].First = First;
+        m_Nodes [NodeIndex].Count = Last - First;
+        return;
+    }
+
+    /* SPLIT AT THE MEDIAN OF THE CENTERS, ALONG THE LONGEST SIDE */
+    bool Vertical = CenterMaxY - CenterMinY > CenterMaxX - CenterMinX;
+    unsigned Middle = (First + Last) / 2;
+
+    nth_element (m_Segments.begin () + First, m_Segments.begin () + Middle, m_Segments.begin () + Last,
+                 [Vertical] (const Segment &A, const Segment &B)
+                 {
+                     return Vertical ? A.Y1 + A.Y2 < B.Y1 + B.Y2 : A.X1 + A.X2 < B.X1 + B.X2;
+                 });
+
+    // The two children follow each other, the vector is reserved so the nodes do not move.
+    unsigned Child = m_Nodes.size ();
+    m_Nodes [NodeIndex].First = Child;
+    m_Nodes [NodeIndex].Count = 0;
+    m_Nodes.resize (Child + 2);
+
+    BuildNode (Child, First, Middle);
+    BuildNode (Child + 1, Middle, Last);
+
+}// BuildNode ()
+
+// Return the number of segments.
+unsigned CSegmentTree::GetSegmentCount () const
+{
+    return m_Segments.size ();
+
+}// GetSegmentCount ()
+
+// Give the ends of a segment.
+void CSegmentTree::GetSegment (unsigned Segment, float &X1, float &Y1, float &X2, float &Y2) const
+{
+    const CSegmentTree::Segment &Current = m_Segments [m_Place [Segment]];
+
+    X1 = Current.X1;
+    Y1 = Current.Y1;
+    X2 = Current.X2;
+    Y2 = Current.Y2;
+
+}// GetSegment ()
+
+// Find the first segment touched before MaxTime by a ball of Radius.
+bool CSegmentTree::FirstImpact (double X, double Y, double VelX, double VelY, double Gravity, double Radius, double MaxTime, Impact &First) const
+{
+    if (m_Nodes.empty ())
+        return false;
+
+    /* BOX AROUND THE ARC FOLLOWED UNTIL MaxTime */
+    double EndX = X + VelX * MaxTime;
+    double EndY = Y + (VelY - 0.5 * Gravity * MaxTime) * MaxTime;
+    double MinY = min (Y, EndY);
+    double MaxY = max (Y, EndY);
+
+    // The top of the parabola is reached during the step.
+    if (Gravity > 0 && VelY > 0 && VelY < Gravity * MaxTime)
+        MaxY = Y + 0.5 * VelY * VelY / Gravity;
+
+    float BoxMinX = min (X, EndX) - Radius;
+    float BoxMaxX = max (X, EndX) + Radius;
+    float BoxMinY = MinY - Radius;
+    float BoxMaxY = MaxY + Radius;
+
+    /* TRAVERSAL, THE SEGMENTS ARE ONLY READ IN THE LEAVES THE BOX TOUCHES */
+    unsigned Stack [MaxDepth];
+    unsigned StackSize = 0;
+    Stack [StackSize++] = 0;
+
+    bool Found = false;
+
+    while (StackSize > 0)
+    {
+        const Node &Current = m_Nodes [Stack [--StackSize]];
+
+        if (Current.MaxX < BoxMinX || Current.MinX > BoxMaxX || Current.MaxY < BoxMinY || Current.MinY > BoxMaxY)
+            continue;
+
+        if (Current.Count == 0)
+        {
+            Stack [StackSize++] = Current.First;
+            Stack [StackSize++] = Current.First + 1;
+            continue;
+        }
+
+        // Only the impacts before the first one found are kept.
+        for (unsigned i = Current.First; i < Current.First + Current.Count; ++i)
+        {
+            float NX;
+            float NY;
+            double Time = SegmentImpact (m_Segments [i], X, Y, VelX, VelY, Gravity, Radius, MaxTime, NX, NY);
+
+            if (Time < 0)
+                continue;
+
+            MaxTime = Time;
+            First.Time = Time;
+            First.NX = NX;
+            First.NY = NY;
+            First.RestitutionCoef = m_Segments [i].RestitutionCoef;
+            First.Segment = m_Segments [i].Index;
+            Found = true;
+        }
+    }
+
+    return Found;
+
+}// FirstImpact ()
+
+// Add to Contacts the segments closer than Radius to the point (X, Y).
+void CSegmentTree::FindContacts (float X, float Y, float Radius, vector <Contact> &Contacts) const
+{
+    FindContacts (X, Y, X, Y, Radius, Contacts);
+
+}// FindContacts ()
+
+// Add to Contacts the segments closer than Radius to the point (X, Y), on the side of the point (FromX, FromY).
+void CSegmentTree::FindContacts (float FromX, float FromY, float X, float Y, float Radius, vector <Contact> &Contacts) const
+{
+    if (m_Nodes.empty ())
+        return;
+
+    // The box holds the move, a segment it crosses may be farther than Radius.
+    float BoxMinX = min (X, FromX) - Radius;
+    float BoxMaxX = max (X, FromX) + Radius;
+    float BoxMinY = min (Y, FromY) - Radius;
+    float BoxMaxY = max (Y, FromY) + Radius;
+
+    unsigned Stack [MaxDepth];
+    unsigned StackSize = 0;
+    Stack [StackSize++] = 0;
+
+    while (StackSize > 0)
+    {
+        const Node &Current = m_Nodes [Stack [--StackSize]];
+
+        if (Current.MaxX < BoxMinX || Current.MinX > BoxMaxX || Current.MaxY < BoxMinY || Current.MinY > BoxMaxY)
+            continue;
+
+        if (Current.Count == 0)
+        {
+            Stack [StackSize++] = Current.First;
+            Stack [StackSize++] = Current.First + 1;
+            continue;
+        }
+
+        for (unsigned i = Current.First; i < Current.First + Current.Count; ++i)
+        {
+            const Segment &Close = m_Segments [i];
+
+            float UX = Close.X2 - Close.X1;
+            float UY = Close.Y2 - Close.Y1;
+            float SquareLength = UX * UX + UY * UY;
+
+            /* CROSSING, the center went through the segment to the other side */
+            // Distances to the line, positive on the left.
+            float SideFrom = Close.NX * (FromX - Close.X1) + Close.NY * (FromY - Close.Y1);
+            float SideTo = Close.NX * (X - Close.X1) + Close.NY * (Y - Close.Y1);
+
+            if (SquareLength > 0 && SideFrom != 0 && (SideFrom > 0) != (SideTo > 0))
+            {
+                // The move meets the line between the ends.
+                float Part = SideFrom / (SideFrom - SideTo);
+                float Projection = ((FromX + Part * (X - FromX) - Close.X1) * UX + (FromY + Part * (Y - FromY) - Close.Y1) * UY) / SquareLength;
+
+                if (Projection >= 0 && Projection <= 1)
+                {
+                    Contact New;
+                    New.Distance = -fabs (SideTo);
+                    New.NX = SideFrom > 0 ? Close.NX : -Close.NX;
+                    New.NY = SideFrom > 0 ? Close.NY : -Close.NY;
+                    New.Segment = Close.Index;
+                    Contacts.push_back (New);
+                    continue;
+                }
+            }
+
+            /* CLOSEST POINT OF THE SEGMENT */
+            float Projection = SquareLength > 0 ? ((X - Close.X1) * UX + (Y - Close.Y1) * UY) / SquareLength : 0;
+            Projection = min (max (Projection, 0.0f), 1.0f);
+
+            float DX = X - Close.X1 - Projection * UX;
+            float DY = Y - Close.Y1 - Projection * UY;
+            float Square = DX * DX + DY * DY;
+
+            if (Square >= Radius * Radius)
+                continue;
+
+            // A center lying on the segment goes back on the left side.
+            Contact New;
+            New.Distance = sqrt (Square);
+            New.NX = New.Distance > 0 ? DX / New.Distance : Close.NX;
+            New.NY = New.Distance > 0 ? DY / New.Distance : Close.NY;
+            New.Segment = Close.Index;
+            Contacts.push_back (New);
+        }
+    }
+
+}// FindContacts ()
+
+// Compute the time of impact of the ball on a segment.
+double CSegmentTree::SegmentImpact (const Segment &Current, double X, double Y, double VelX, double VelY, double Gravity,
+                                    double Radius, double MaxTime, float &NX, float &NY) const
+{
+    double Best = -1;
+
+    double UX = Current.X2 - Current.X1;
+    double UY = Current.Y2 - Current.Y1;
+    double SquareLength = UX * UX + UY * UY;
+
+    /* SIDES OF THE SEGMENT */
+    // Distance to the line : S0 + SV * t + SA * t * t, positive on the left.
+    double S0 = Current.NX * (X - Current.X1) + Current.NY * (Y - Current.Y1);
+    double SV = Current.NX * VelX + Current.NY * VelY;
+    double SA = -0.5 * Gravity * Current.NY;
+
+    // Side where the ball is, or the one it comes from if it lies on the line.
+    double Side = S0 > 0 || (S0 == 0 && SV < 0) ? 1 : -1;
+
+    for (unsigned Face = 0; Face < 2 && SquareLength > 0; ++Face, Side = -Side)
+    {
+        // Distance to the side minus the radius : A * t * t + B * t + C.
+        double A = Side * SA;
+        double B = Side * SV;
+        double C = Side * S0 - Radius;
+
+        // A ball of the right side already in the segment and not going away touches it now, the first time is when it reaches the side.
+        double Time;
+        if (Face == 0 && C <= 0 && B <= 0)
+            Time = 0;
+        else
+            Time = CrossingComputing (A, B, C, false);
+
+        if (Time < 0 || Time > MaxTime || (Best >= 0 && Time >= Best))
+            continue;
+
+        // The ball must be in front of the segment, beyond the ends only the ends are touched.
+        double PX = X + VelX * Time - Current.X1;
+        double PY = Y + (VelY - 0.5 * Gravity * Time) * Time - Current.Y1;
+        double Projection = PX * UX + PY * UY;
+
+        if (Projection < 0 || Projection > SquareLength)
+            continue;
+
+        Best = Time;
+        NX = Side * Current.NX;
+        NY = Side * Current.NY;
+    }
+
+    /* ENDS OF THE SEGMENT */
+    // A point does not touch the ends, its path crosses the segment first.
+    if (Radius <= 0)
+        return Best;
+
+    for (unsigned End = 0; End < 2; ++End)
+    {
+        double EX = End == 0 ? Current.X1 : Current.X2;
+        double EY = End == 0 ? Current.Y1 : Current.Y2;
+
+        // The end does not move, the relative acceleration is the opposite of the one of the ball.
+        double Time = ContactComputing (EX - X, EY - Y, -VelX, -VelY, 0, Gravity, Radius);
+
+        if (Time < 0 || Time > MaxTime || (Best >= 0 && Time >= Best))
+            continue;
+
+        double DX = X + VelX * Time - EX;
+        double DY = Y + (VelY - 0.5 * Gravity * Time) * Time - EY;
+        double Distance = sqrt (DX * DX + DY * DY);
+
+        if (Distance <= 0)
+            continue;
+
+        Best = Time;
+        NX = DX / Distance;
+        NY = DY / Distance;
+    }
+
+    return Best;
+
+}// SegmentImpact ()
@@ -0,0 +1,127 @@
+/**
+ *
+ * @file CSegmentTree.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CSegmentTree header file.
+ *
+ * @details Contain declaration of the class CSegmentTree, the static segments the balls bounce on (ramps, funnels, inner walls).
+ *          The segments are stored in a bounding volume hierarchy : a query only reads the segments close to the arc
+ *          followed by the ball, whatever their number, and computes the exact time of impact of the parabola on them.
+ *
+ * @see CSegmentTree.cpp
+ *
+ **/
+
+#ifndef __CSEGMENTTREE_H__
+#define __CSEGMENTTREE_H__
+
+#include <vector>       // std::vector
+
+/*
+** CSegmentTree class that finds the first segment touched by a ball.
+*/
+class CSegmentTree
+{
+    public :
+
+        // Store the first impact of a ball on a segment.
+        struct Impact
+        {
+            double Time;                // the time of the impact.
+            float NX;                   // the normal of the touched side, going toward the ball.
+            float NY;
+            float RestitutionCoef;      // the coefficient of the segment, negative to use the one of the ball.
+            unsigned Segment;           // the index of the segment.
+        };
+
+        // Store a segment overlapping a ball.
+        struct Contact
+        {
+            float Distance;             // the distance between the center of the ball and the segment, negative behind it.
+            float NX;                   // the normal going from the segment toward the ball.
+            float NY;
+            unsigned Segment;           // the index of the segment.
+        };
+
+        // Initialize a tree without any segment.
+        CSegmentTree ();
+
+        // Remove every segment.
+        void Clear ();
+
+        // Add the segment from (X1, Y1) to (X2, Y2), RestitutionCoef negative to use the one of the ball. Return its index.
+        unsigned AddSegment (float X1, float Y1, float X2, float Y2, float RestitutionCoef = -1);
+
+        // Read the segments of a file, one "X1 Y1 X2 Y2 [RestitutionCoef]" per line, '#' starts a comment.
+        // Return false if the file can not be read or a line is wrong.
+        bool Load (const char *FileName);
+
+        // Build the hierarchy of the segments, to call after the last AddSegment ().
+        void Build ();
+
+        // Return the number of segments.
+        unsigned GetSegmentCount () const;
+
+        // Give the ends of a segment.
+        void GetSegment (unsigned Segment, float &X1, float &Y1, float &X2, float &Y2) const;
+
+        // Find the first segment touched before MaxTime by a ball of Radius, at (X, Y) with the velocity (VelX, VelY) and falling with Gravity.
+        // Return false if there is none.
+        bool FirstImpact (double X, double Y, double VelX, double VelY, double Gravity, double Radius, double MaxTime, Impact &First) const;
+
+        // Add to Contacts the segments closer than Radius to the point (X, Y).
+        void FindContacts (float X, float Y, float Radius, std::vector <Contact> &Contacts) const;
+
+        // Add to Contacts the segments closer than Radius to the point (X, Y), on the side of the point (FromX, FromY) it was
+        // moved from. A segment crossed by the move is added with its normal toward (FromX, FromY) and a negative distance.
+        void FindContacts (float FromX, float FromY, float X, float Y, float Radius, std::vector <Contact> &Contacts) const;
+
+    private :
+
+        // Store a segment.
+        struct Segment
+        {
+            float X1;                   // the ends.
+            float Y1;
+            float X2;
+            float Y2;
+            float NX;                   // the unit normal, on the left of the segment.
+            float NY;
+            float RestitutionCoef;      // the coefficient, negative to use the one of the ball.
+            unsigned Index;             // the index given by AddSegment ().
+        };
+
+        // Store a node of the hierarchy, its children follow each other.
+        struct Node
+        {
+            float MinX;                 // the box around the segments of the node.
+            float MinY;
+            float MaxX;
+            float MaxY;
+            unsigned First;             // the first child, or the first segment of a leaf.
+            unsigned Count;             // the number of segments of a leaf, 0 for an inner node.
+        };
+
+        // Build the node of the segments between First and Last.
+        void BuildNode (unsigned NodeIndex, unsigned First, unsigned Last);
+
+        // Compute the time of impact of the ball on a segment, negative if it does not touch it before MaxTime.
+        double SegmentImpact (const Segment &Current, double X, double Y, double VelX, double VelY, double Gravity,
+                              double Radius, double MaxTime, float &NX, float &NY) const;
+
+        // Segments, sorted by leaves once the hierarchy is built.
+        std::vector <Segment> m_Segments;
+
+        // Nodes of the hierarchy, the root first.
+        std::vector <Node> m_Nodes;
+
+        // Place of each segment in m_Segments.
+        std::vector <unsigned> m_Place;
+};
+#endif // __CSEGMENTTREE_H__
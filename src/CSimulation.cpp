@@ -0,0 +1,369 @@
+/**
+ *
+ * @file CSimulation.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CSimulation source file.
+ *
+ * @details Contain the implementation of the class CSimulation.
+ *
+ * @see CSimulation.h
+ *
+ **/
+
+#include <utility>      // std::pair
+#include <math.h>       // sqrt, atan2, fabs
+#include <algorithm>    // std::min, std::max
+
+#include "CSimulation.h"    // Class header
+#include "physics.h"        // Trajectory and collision functions
+#include "fastmath.h"       // FastSinCos
+#include "CSegmentTree.h"   // Static segments
+#include "CTerrain.h"       // Uneven floor
+#include "CIntegrator.h"    // Drag integration
+#include "common.h"         // Settings struct, PI, REST_FLIGHT_TIME, SURFACE_SKIN, SLIDE_FRICTION
+
+using namespace std;
+using namespace nsTools;
+
+// Initialize the simulation with the user parameters.
+CSimulation::CSimulation (const Settings &Parameters) : m_Settings (Parameters), m_SaveSettings (Parameters), m_Segments (0), m_Terrain (0), m_Integrating (false)
+{
+    // Set the last parameters.
+    m_SaveSettings.Time = 0;
+    m_SaveSettings.TotalTime = 0;
+    m_SaveSettings.Dir = LEFTTORIGHT;
+
+    Reset ();
+
+}// CSimulation ()
+
+// Set back the simulation at its initial state.
+void CSimulation::Reset ()
+{
+    m_Settings = m_SaveSettings;
+    m_BounceCount = 0;
+    m_Resting = false;
+
+    // The launch angle is only used once, to get the velocity vector.
+    m_OriginX = 0;
+    m_OriginY = m_Settings.InitPos;
+    float Sin;
+    float Cos;
+    FastSinCos (m_Settings.Angle, Sin, Cos);
+
+    m_VelX = m_Settings.Speed * Cos;
+    m_VelY = m_Settings.Speed * Sin;
+
+    // The ball starts at its initial position.
+    m_Old = make_pair (m_OriginX, m_OriginY);
+    m_New = m_Old;
+    m_Previous = m_Old;
+
+    // Nothing to simulate yet.
+    m_Accumulator = 0;
+    m_FixedStep = 0;
+
+}// Reset ()
+
+// Set the static segments the ball bounces on, 0 for none.
+void CSimulation::SetSegments (const CSegmentTree *Segments)
+{
+    m_Segments = Segments;
+
+}// SetSegments ()
+
+// Set the uneven floor the ball bounces on, 0 for the flat one.
+void CSimulation::SetTerrain (const CTerrain *Terrain)
+{
+    m_Terrain = Terrain;
+
+}// SetTerrain ()
+
+// Set the integrator of the flight of the ball, 0 for the closed form of the parabola.
+void CSimulation::SetIntegrator (const CIntegrator *Integrator)
+{
+    m_Integrating = Integrator != 0;
+    if (m_Integrating)
+        m_Integrator = *Integrator;
+
+}// SetIntegrator ()
+
+// Advance the simulation of TimeStep seconds.
+void CSimulation::Step (float TimeStep)
+{
+    // Set the total time of the simulation
+    m_Settings.TotalTime += TimeStep;
+
+    // The point at t = t is the last computed one.
+    m_Old = m_New;
+
+    float Gravity = m_Resting ? 0 : m_Settings.Gravity;
+
+    // The ball sliding on the floor is slowed down by the friction, against its velocity.
+    float Friction = 0;
+    if (m_Resting && m_VelY == 0 && m_VelX != 0)
+        Friction = (m_VelX > 0 ? 1 : -1) * SLIDE_FRICTION * m_Settings.Gravity;
+
+    // With the drag, the ball follows during the step the parabola going through the points integrated at both ends.
+    // The segments, the terrain and the walls are then found on it as without drag.
+    double EndX = 0;
+    double EndY = 0;
+    double EndVelX = 0;
+    double EndVelY = 0;
+    if (m_Integrating)
+    {
+        pair <float, float> Velocity = GetVelocity ();
+        EndX = m_Old.first;
+        EndY = m_Old.second;
+        EndVelX = Velocity.first;
+        EndVelY = Velocity.second;
+        m_Integrator.Step (EndX, EndY, EndVelX, EndVelY, Gravity, TimeStep);
+
+        m_OriginX = m_Old.first;
+        m_OriginY = m_Old.second;
+        m_VelX = (EndX - m_OriginX) / TimeStep;
+        m_VelY = (EndY - m_OriginY) / TimeStep + 0.5f * Gravity * TimeStep;
+        m_Settings.Time = 0;
+    }
+
+    // Add time and compute the point at t = t + TimeStep.
+    float Time = m_Settings.Time + TimeStep;
+    m_Settings.Time = Time;
+
+    m_New = make_pair (m_OriginX + m_VelX * Time, m_OriginY + m_VelY * Time - 0.5f * Gravity * Time * Time);
+
+    // The slide stops once the friction took all the speed, the ball does not go back.
+    float SlideVelX = 0;
+    if (Friction != 0)
+    {
+        float Sliding = min (Time, m_VelX / Friction);
+        m_New.first = m_OriginX + m_VelX * Sliding - 0.5f * Friction * Sliding * Sliding;
+        SlideVelX = Sliding < Time ? 0 : (m_Integrating ? EndVelX : m_VelX) - Friction * Sliding;
+    }
+
+    /*
+    ** SEGMENTS AND TERRAIN
+    */
+    // The ball stops on the first segment or piece of terrain touched during the step, the walls are checked at the next one.
+    float StepVelY = m_VelY - Gravity * (Time - TimeStep);
+    CSegmentTree::Impact First;
+    bool OnSegment = m_Segments != 0 && m_Segments->FirstImpact (m_Old.first, m_Old.second, m_VelX, StepVelY, Gravity, 0, TimeStep, First);
+
+    double TerrainTime;
+    float NX;
+    float NY;
+    if (m_Terrain != 0 && m_Terrain->FirstImpact (m_Old.first, m_Old.second, m_VelX, StepVelY, Gravity, OnSegment ? First.Time : TimeStep, TerrainTime, NX, NY))
+    {
+        SurfaceBounce (TerrainTime, NX, NY, -1, Gravity, TimeStep);
+        return;
+    }
+
+    if (OnSegment)
+    {
+        SurfaceBounce (First.Time, First.NX, First.NY, First.RestitutionCoef, Gravity, TimeStep);
+        return;
+    }
+
+    /*
+    ** COLLISION DETECTION
+    */
+    unsigned Code = CollisionDetectionBorder (m_New.first) | CollisionDetectionBottomTop (m_New.second) << 2;
+
+    if (Code != 0)
+    {
+        // Velocity at the impact, reflected on the touched surfaces.
+        float VelX = Friction != 0 ? SlideVelX : m_VelX;
+        float VelY = ImpactVelocityComputing (m_VelY - Gravity * Time, m_New.second, Gravity);
+
+        m_BounceCount += ReflectionComputing (VelX, VelY, Code, m_Settings.RestitutionCoef);
+
+        // A flight shorter than two steps can not be followed (the ball keeps the speed gained during the last step),
+        // the next bounces on the floor are summed and the ball slides.
+        unsigned Bounces;
+        if ((Code & COLLISION_BOTTOM) && RestComputing (VelY, Gravity, m_Settings.RestitutionCoef, max (REST_FLIGHT_TIME, 2.0 * TimeStep), Bounces) >= 0)
+        {
+            m_BounceCount += Bounces;
+            m_Resting = true;
+            VelY = 0;
+        }
+
+        // The new trajectory starts from the touched surfaces.
+        m_New = ClampComputing (m_New);
+
+        // In the corner of a wall and the terrain, the clamped ball is put back over the terrain.
+        if (m_Terrain != 0)
+            m_New.second = max (m_New.second, m_Terrain->GetHeight (m_New.first) + (float) SURFACE_SKIN);
+
+        m_OriginX = m_New.first;
+        m_OriginY = m_New.second;
+        m_VelX = VelX;
+        m_VelY = VelY;
+
+        // Update the settings of the new trajectory.
+        m_Settings.Time = 0;
+        m_Settings.InitPos = m_OriginY;
+        m_Settings.Speed = sqrt (VelX * VelX + VelY * VelY);
+        m_Settings.Dir = VelX < 0 ? RIGHTTOLEFT : LEFTTORIGHT;
+    }
+    // The sliding ball starts again from the end of the step, at the speed left by the friction.
+    else if (Friction != 0)
+    {
+        m_OriginX = m_New.first;
+        m_VelX = SlideVelX;
+        m_Settings.Time = 0;
+        m_Settings.Speed = fabs (SlideVelX);
+        m_Settings.Dir = SlideVelX < 0 ? RIGHTTOLEFT : LEFTTORIGHT;
+    }
+    // Without any bounce, the ball leaves the step at the integrated velocity.
+    else if (m_Integrating)
+    {
+        m_VelX = EndVelX;
+        m_VelY = EndVelY + Gravity * Time;
+
+        m_Settings.Speed = sqrt (EndVelX * EndVelX + EndVelY * EndVelY);
+        m_Settings.Dir = EndVelX < 0 ? RIGHTTOLEFT : LEFTTORIGHT;
+    }
+
+}// Step ()
+
+// Compute the new trajectory of the ball that touched a surface of normal (NX, NY) Time seconds after the beginning of the last step.
+void CSimulation::SurfaceBounce (float Time, float NX, float NY, float RestitutionCoef, float Gravity, float TimeStep)
+{
+    // Position and velocity at the impact, from the beginning of the step.
+    float VelX = m_VelX;
+    float VelY = m_VelY - Gravity * (m_Settings.Time - TimeStep);
+    float X = m_Old.first + VelX * Time;
+    float Y = m_Old.second + VelY * Time - 0.5f * Gravity * Time * Time;
+    VelY -= Gravity * Time;
+
+    // Reflect the velocity on the touched side, too short a flight off the surface makes the ball slide along it.
+    if (RestitutionCoef < 0)
+        RestitutionCoef = m_Settings.RestitutionCoef;
+    if (SurfaceReflectionComputing (VelX, VelY, NX, NY, RestitutionCoef, Gravity, max (REST_FLIGHT_TIME, 2.0 * TimeStep)))
+        ++m_BounceCount;
+
+    // The gravity pulls the ball again, unless it stopped on the surface.
+    m_Resting = sqrt (VelX * VelX + VelY * VelY) < REST_SPEED;
+    if (m_Resting)
+    {
+        VelX = 0;
+        VelY = 0;
+    }
+
+    // The new trajectory starts in front of the surface.
+    m_New = ClampComputing (make_pair (X + (float) SURFACE_SKIN * NX, Y + (float) SURFACE_SKIN * NY));
+
+    m_OriginX = m_New.first;
+    m_OriginY = m_New.second;
+    m_VelX = VelX;
+    m_VelY = VelY;
+
+    // Update the settings of the new trajectory.
+    m_Settings.Time = 0;
+    m_Settings.InitPos = m_OriginY;
+    m_Settings.Speed = sqrt (VelX * VelX + VelY * VelY);
+    m_Settings.Dir = VelX < 0 ? RIGHTTOLEFT : LEFTTORIGHT;
+
+}// SurfaceBounce ()
+
+// Accumulate ElapsedTime seconds of wall-clock time and run as many steps of FixedStep seconds as needed.
+unsigned CSimulation::Advance (float ElapsedTime, float FixedStep, unsigned MaxSteps/* = 250*/)
+{
+    m_FixedStep = FixedStep;
+    m_Accumulator += ElapsedTime;
+
+    unsigned Steps = 0;
+
+    // The steps always have the same length so the results do not depend on the rendering.
+    while (m_Accumulator >= FixedStep && Steps < MaxSteps)
+    {
+        m_Previous = m_New;
+        Step (FixedStep);
+        m_Accumulator -= FixedStep;
+        ++Steps;
+    }
+
+    // Too late to catch up, drop the time instead of slowing down every next frame.
+    if (m_Accumulator >= FixedStep)
+        m_Accumulator = 0;
+
+    return Steps;
+
+}// Advance ()
+
+// Tells if the ball stopped.
+bool CSimulation::IsStopped () const
+{
+    return m_Settings.Speed < 0.000001;
+
+}// IsStopped ()
+
+// Tells if the bounces on the floor became too small to be followed, the ball slides on it.
+bool CSimulation::IsResting () const
+{
+    return m_Resting;
+
+}// IsResting ()
+
+// Return the current settings of the trajectory.
+const Settings &CSimulation::GetSettings () const
+{
+    return m_Settings;
+
+}// GetSettings ()
+
+// Return the position of the ball at the beginning of the last step.
+pair <float, float> CSimulation::GetOldPosition () const
+{
+    return m_Old;
+
+}// GetOldPosition ()
+
+// Return the position of the ball at the end of the last step.
+pair <float, float> CSimulation::GetNewPosition () const
+{
+    return m_New;
+
+}// GetNewPosition ()
+
+// Return the position of the ball between the two last steps of Advance (), at the time not yet simulated.
+pair <float, float> CSimulation::GetInterpolatedPosition () const
+{
+    if (m_FixedStep <= 0)
+        return m_New;
+
+    float Alpha = m_Accumulator / m_FixedStep;
+
+    return make_pair (m_Previous.first + (m_New.first - m_Previous.first) * Alpha,
+                      m_Previous.second + (m_New.second - m_Previous.second) * Alpha);
+
+}// GetInterpolatedPosition ()
+
+// Return the velocity of the ball at the end of the last step.
+pair <float, float> CSimulation::GetVelocity () const
+{
+    return make_pair (m_VelX, m_Resting ? 0 : m_VelY - m_Settings.Gravity * m_Settings.Time);
+
+}// GetVelocity ()
+
+// Return the angle of the ball at the end of the last step.
+float CSimulation::GetCurrentAngle () const
+{
+    pair <float, float> Velocity = GetVelocity ();
+
+    return atan2 (Velocity.second, Velocity.first);
+
+}// GetCurrentAngle ()
+
+// Return the number of bounces since the beginning.
+unsigned CSimulation::GetBounceCount () const
+{
+    return m_BounceCount;
+
+}// GetBounceCount ()
@@ -0,0 +1,133 @@
+/**
+ *
+ * @file CSimulation.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CSimulation header file.
+ *
+ * @details Contain declaration of the class CSimulation, the headless simulation engine.
+ *          It does not depend on SDL, GLEW or glm.
+ *
+ * @see CSimulation.cpp
+ *
+ **/
+
+#ifndef __CSIMULATION_H__
+#define __CSIMULATION_H__
+
+#include <utility>      // std::pair
+
+#include "common.h"     // Settings struct
+#include "CSegmentTree.h"   // Static segments
+#include "CTerrain.h"       // Uneven floor
+#include "CIntegrator.h"    // Drag integration
+
+/*
+** CSimulation class that computes the trajectory of the ball, one step after the other.
+** The ball carries its velocity vector, the bounces reflect it without any angle computing.
+*/
+class CSimulation
+{
+    public :
+
+        // Initialize the simulation with the user parameters.
+        CSimulation (const nsTools::Settings &Parameters);
+
+        // Set back the simulation at its initial state.
+        void Reset ();
+
+        // Set the static segments the ball bounces on, 0 for none. The segments are not copied.
+        void SetSegments (const CSegmentTree *Segments);
+
+        // Set the uneven floor the ball bounces on, 0 for the flat one. The terrain is not copied.
+        void SetTerrain (const CTerrain *Terrain);
+
+        // Set the integrator of the flight of the ball slowed down by the air, 0 for the closed form of the parabola.
+        // The integrator is copied, the adaptive one keeps the length of its steps for this ball.
+        void SetIntegrator (const CIntegrator *Integrator);
+
+        // Advance the simulation of TimeStep seconds.
+        void Step (float TimeStep);
+
+        // Accumulate ElapsedTime seconds of wall-clock time and run as many steps of FixedStep seconds as needed.
+        // At most MaxSteps steps are run, the remaining time is dropped. Return the number of steps.
+        unsigned Advance (float ElapsedTime, float FixedStep, unsigned MaxSteps = 250);
+
+        // Tells if the ball stopped.
+        bool IsStopped () const;
+
+        // Tells if the bounces on the floor became too small to be followed, the ball slides on it.
+        bool IsResting () const;
+
+        // Return the current settings of the trajectory.
+        const nsTools::Settings &GetSettings () const;
+
+        // Return the position of the ball at the beginning of the last step.
+        std::pair <float, float> GetOldPosition () const;
+
+        // Return the position of the ball at the end of the last step.
+        std::pair <float, float> GetNewPosition () const;
+
+        // Return the position of the ball between the two last steps of Advance (), at the time not yet simulated.
+        std::pair <float, float> GetInterpolatedPosition () const;
+
+        // Return the velocity of the ball at the end of the last step.
+        std::pair <float, float> GetVelocity () const;
+
+        // Return the angle of the ball at the end of the last step.
+        float GetCurrentAngle () const;
+
+        // Return the number of bounces since the beginning.
+        unsigned GetBounceCount () const;
+
+    private :
+
+        // Compute the new trajectory of the ball that touched a surface of normal (NX, NY) Time seconds after the beginning of the last step.
+        // RestitutionCoef is the one of the surface, negative to use the one of the ball.
+        void SurfaceBounce (float Time, float NX, float NY, float RestitutionCoef, float Gravity, float TimeStep);
+
+        // Contain the current trajectory variables.
+        nsTools::Settings m_Settings;
+
+        // Contain the settings to start again.
+        nsTools::Settings m_SaveSettings;
+
+        // Old and new point (center of our ball).
+        std::pair <float, float> m_Old;
+        std::pair <float, float> m_New;
+
+        // Position and velocity at the beginning of the current trajectory.
+        float m_OriginX;
+        float m_OriginY;
+        float m_VelX;
+        float m_VelY;
+
+        // Number of bounces since the beginning.
+        unsigned m_BounceCount;
+
+        // Tells if the ball slides on the floor, the gravity does not move it anymore.
+        bool m_Resting;
+
+        // Static segments the ball bounces on.
+        const CSegmentTree *m_Segments;
+
+        // Uneven floor the ball bounces on.
+        const CTerrain *m_Terrain;
+
+        // Integrator of the flight, used if m_Integrating.
+        CIntegrator m_Integrator;
+        bool m_Integrating;
+
+        // Position at the end of the step before the last one, to interpolate.
+        std::pair <float, float> m_Previous;
+
+        // Wall-clock time not yet simulated and fixed step used by Advance ().
+        float m_Accumulator;
+        float m_FixedStep;
+};
+#endif // __CSIMULATION_H__
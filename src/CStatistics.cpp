@@ -0,0 +1,256 @@
+/**
+ *
+ * @file CStatistics.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CStatistics source file.
+ *
+ * @details Contain the implementation of the class CStatistics.
+ *
+ * @see CStatistics.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <limits>       // std::numeric_limits
+#include <algorithm>    // std::min, std::max
+#include <math.h>       // log, pow, ceil, fabs
+
+#include "CStatistics.h"    // Class header
+
+using namespace std;
+
+namespace
+{
+    // Magnitude under which a value is counted as 0 by the sketch.
+    const double MinMagnitude = 1e-9;
+}
+
+// Initialize an empty accumulator.
+CStatistics::CStatistics (double Low/* = 0*/, double High/* = 1*/, unsigned BinCount/* = 0*/, double Accuracy/* = 0.01*/) : m_Low (Low), m_High (High),
+                                                                                                                          m_Bins (BinCount, 0), m_Accuracy (Accuracy)
+{
+    // The middle of a bucket is within Accuracy of any value of the bucket.
+    m_Gamma = (1 + Accuracy) / (1 - Accuracy);
+    m_InvLogGamma = 1 / log (m_Gamma);
+
+    Clear ();
+
+}// CStatistics ()
+
+// Forget the values.
+void CStatistics::Clear ()
+{
+    m_Count = 0;
+    m_Mean = 0;
+    m_SquaredDeviations = 0;
+    m_Min = numeric_limits <double>::infinity ();
+    m_Max = -numeric_limits <double>::infinity ();
+    fill (m_Bins.begin (), m_Bins.end (), 0);
+
+    // The buckets keep their memory.
+    m_Positive.Offset = 0;
+    m_Positive.Counts.clear ();
+    m_Negative.Offset = 0;
+    m_Negative.Counts.clear ();
+    m_Zeros = 0;
+
+}// Clear ()
+
+// Return an empty accumulator whose histogram covers the values added to this one.
+CStatistics CStatistics::GetCovering (unsigned BinCount, bool Integers/* = false*/) const
+{
+    if (m_Count == 0)
+        return CStatistics (0, 1, BinCount, m_Accuracy);
+
+    if (Integers)
+        return CStatistics (m_Min, m_Max + 1, (unsigned) min (m_Max - m_Min + 1, (double) BinCount), m_Accuracy);
+
+    return CStatistics (m_Min, m_Max, BinCount, m_Accuracy);
+
+}// GetCovering ()
+
+// Add Count values to a bucket.
+void CStatistics::Increment (Buckets &Sketch, int Bucket, unsigned long long Count)
+{
+    if (Sketch.Counts.empty ())
+        Sketch.Offset = Bucket;
+
+    // The buckets grow on both sides, the values of a stream are usually close to each other.
+    if (Bucket < Sketch.Offset)
+    {
+        Sketch.Counts.insert (Sketch.Counts.begin (), Sketch.Offset - Bucket, 0);
+        Sketch.Offset = Bucket;
+    }
+    if (Bucket - Sketch.Offset >= (int) Sketch.Counts.size ())
+        Sketch.Counts.resize (Bucket - Sketch.Offset + 1, 0);
+
+    Sketch.Counts [Bucket - Sketch.Offset] += Count;
+
+}// Increment ()
+
+// Return the bucket of a magnitude.
+int CStatistics::GetBucket (double Magnitude) const
+{
+    return (int) ceil (log (Magnitude) * m_InvLogGamma);
+
+}// GetBucket ()
+
+// Return the value standing for a bucket.
+double CStatistics::GetBucketValue (int Bucket) const
+{
+    return 2 * pow (m_Gamma, Bucket) / (m_Gamma + 1);
+
+}// GetBucketValue ()
+
+// Add a value.
+void CStatistics::Add (double Value)
+{
+    ++m_Count;
+    double Deviation = Value - m_Mean;
+    m_Mean += Deviation / m_Count;
+    m_SquaredDeviations += Deviation * (Value - m_Mean);
+    m_Min = min (m_Min, Value);
+    m_Max = max (m_Max, Value);
+
+    if (! m_Bins.empty ())
+    {
+        double Bin = m_High > m_Low ? (Value - m_Low) / (m_High - m_Low) * m_Bins.size () : 0;
+        ++m_Bins [Bin <= 0 ? 0 : min ((unsigned long long) Bin, (unsigned long long) m_Bins.size () - 1)];
+    }
+
+    if (fabs (Value) < MinMagnitude)
+        ++m_Zeros;
+    else if (Value > 0)
+        Increment (m_Positive, GetBucket (Value), 1);
+    else
+        Increment (m_Negative, GetBucket (-Value), 1);
+
+}// Add ()
+
+// Add the values of an accumulator.
+void CStatistics::Merge (const CStatistics &Other)
+{
+    if (Other.m_Count == 0)
+        return;
+
+    // The moments are merged by the formula of Chan et al.
+    unsigned long long Count = m_Count + Other.m_Count;
+    double Deviation = Other.m_Mean - m_Mean;
+    m_Mean += Deviation * Other.m_Count / Count;
+    m_SquaredDeviations += Other.m_SquaredDeviations + Deviation * Deviation * m_Count / Count * Other.m_Count;
+    m_Count = Count;
+    m_Min = min (m_Min, Other.m_Min);
+    m_Max = max (m_Max, Other.m_Max);
+
+    for (unsigned i = 0; i < m_Bins.size () && i < Other.m_Bins.size (); ++i)
+        m_Bins [i] += Other.m_Bins [i];
+
+    for (unsigned i = 0; i < Other.m_Positive.Counts.size (); ++i)
+        if (Other.m_Positive.Counts [i] > 0)
+            Increment (m_Positive, Other.m_Positive.Offset + i, Other.m_Positive.Counts [i]);
+
+    for (unsigned i = 0; i < Other.m_Negative.Counts.size (); ++i)
+        if (Other.m_Negative.Counts [i] > 0)
+            Increment (m_Negative, Other.m_Negative.Offset + i, Other.m_Negative.Counts [i]);
+
+    m_Zeros += Other.m_Zeros;
+
+}// Merge ()
+
+// Return the number of values.
+unsigned long long CStatistics::GetCount () const
+{
+    return m_Count;
+
+}// GetCount ()
+
+// Return the mean of the values.
+double CStatistics::GetMean () const
+{
+    return m_Mean;
+
+}// GetMean ()
+
+// Return the variance of the values.
+double CStatistics::GetVariance () const
+{
+    return m_Count > 1 ? m_SquaredDeviations / (m_Count - 1) : 0;
+
+}// GetVariance ()
+
+// Return the lowest value.
+double CStatistics::GetMin () const
+{
+    return m_Min;
+
+}// GetMin ()
+
+// Return the highest value.
+double CStatistics::GetMax () const
+{
+    return m_Max;
+
+}// GetMax ()
+
+// Return the value under which are the fraction Fraction of the values.
+double CStatistics::GetQuantile (double Fraction) const
+{
+    if (m_Count == 0)
+        return 0;
+
+    // The values are gone through in increasing order : the negative ones from the largest magnitude, 0, then the positive ones.
+    unsigned long long Rank = (unsigned long long) (min (max (Fraction, 0.0), 1.0) * (m_Count - 1));
+    unsigned long long Seen = 0;
+    double Value = m_Max;
+
+    for (unsigned i = m_Negative.Counts.size (); i > 0; --i)
+    {
+        Seen += m_Negative.Counts [i - 1];
+        if (Seen > Rank)
+            return min (max (-GetBucketValue (m_Negative.Offset + i - 1), m_Min), m_Max);
+    }
+
+    Seen += m_Zeros;
+    if (Seen > Rank)
+        return min (max (0.0, m_Min), m_Max);
+
+    for (unsigned i = 0; i < m_Positive.Counts.size (); ++i)
+    {
+        Seen += m_Positive.Counts [i];
+        if (Seen > Rank)
+        {
+            Value = GetBucketValue (m_Positive.Offset + i);
+            break;
+        }
+    }
+
+    return min (max (Value, m_Min), m_Max);
+
+}// GetQuantile ()
+
+// Return the beginning of the histogram.
+double CStatistics::GetLow () const
+{
+    return m_Low;
+
+}// GetLow ()
+
+// Return the end of the histogram.
+double CStatistics::GetHigh () const
+{
+    return m_High;
+
+}// GetHigh ()
+
+// Return the number of values of each bin.
+const vector <unsigned long long> &CStatistics::GetBins () const
+{
+    return m_Bins;
+
+}// GetBins ()
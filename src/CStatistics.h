@@ -0,0 +1,106 @@
+/**
+ *
+ * @file CStatistics.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CStatistics header file.
+ *
+ * @details Contain declaration of the class CStatistics, which sums up a stream of values without keeping them :
+ *          their number, their mean and variance (Welford), their extremes, a histogram over given bounds and a
+ *          quantile sketch. The sketch counts the values in buckets whose bounds grow geometrically (DDSketch,
+ *          Masson et al., 2019) : any quantile is given with a relative error bounded by the accuracy.
+ *          Two accumulators of the same bounds are merged : the counts add up exactly in any order, while the
+ *          rounding of the mean and the variance depends on the order of the merges.
+ *
+ * @see CStatistics.cpp
+ *
+ **/
+
+#ifndef __CSTATISTICS_H__
+#define __CSTATISTICS_H__
+
+#include <vector>       // std::vector
+
+/*
+** CStatistics class that accumulates the distribution of a stream of values.
+*/
+class CStatistics
+{
+    public :
+
+        // Initialize an empty accumulator, its histogram has BinCount bins over [Low, High] and its quantiles a relative
+        // error of Accuracy. The values out of the bounds are counted in the first or the last bin.
+        CStatistics (double Low = 0, double High = 1, unsigned BinCount = 0, double Accuracy = 0.01);
+
+        // Forget the values, the bounds and the accuracy are kept.
+        void Clear ();
+
+        // Return an empty accumulator of the same accuracy, whose histogram of BinCount bins covers the values added to
+        // this one. With Integers each integer value has its own bin, up to BinCount bins.
+        CStatistics GetCovering (unsigned BinCount, bool Integers = false) const;
+
+        // Add a value.
+        void Add (double Value);
+
+        // Add the values of an accumulator of the same bounds and accuracy.
+        void Merge (const CStatistics &Other);
+
+        // Return the number of values, their mean and their variance (0 under two values).
+        unsigned long long GetCount () const;
+        double GetMean () const;
+        double GetVariance () const;
+
+        // Return the lowest and the highest values.
+        double GetMin () const;
+        double GetMax () const;
+
+        // Return the value under which are the fraction Fraction of the values, 0 if there is none.
+        double GetQuantile (double Fraction) const;
+
+        // Return the bounds of the histogram and the number of values of each bin.
+        double GetLow () const;
+        double GetHigh () const;
+        const std::vector <unsigned long long> &GetBins () const;
+
+    private :
+
+        // Store the buckets of the sketch of a sign, from the bucket Offset on.
+        struct Buckets
+        {
+            int Offset;
+            std::vector <unsigned long long> Counts;
+        };
+
+        // Add Count values to a bucket.
+        static void Increment (Buckets &Sketch, int Bucket, unsigned long long Count);
+
+        // Return the bucket of a magnitude, and the value standing for a bucket.
+        int GetBucket (double Magnitude) const;
+        double GetBucketValue (int Bucket) const;
+
+        // Number, mean, sum of the squared deviations to the mean, and extremes of the values.
+        unsigned long long m_Count;
+        double m_Mean;
+        double m_SquaredDeviations;
+        double m_Min;
+        double m_Max;
+
+        // Histogram.
+        double m_Low;
+        double m_High;
+        std::vector <unsigned long long> m_Bins;
+
+        // Relative error of the quantiles, ratio of the bounds of a bucket, and buckets of the positive and negative values, the smallest ones counted apart.
+        double m_Accuracy;
+        double m_Gamma;
+        double m_InvLogGamma;
+        Buckets m_Positive;
+        Buckets m_Negative;
+        unsigned long long m_Zeros;
+};
+#endif // __CSTATISTICS_H__
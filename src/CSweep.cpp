@@ -0,0 +1,246 @@
+/**
+ *
+ * @file CSweep.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CSweep source file.
+ *
+ * @details Contain the implementation of the class CSweep.
+ *
+ * @see CSweep.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <thread>       // std::thread::hardware_concurrency
+#include <algorithm>    // std::min, std::max
+#include <memory>       // std::make_shared
+
+#include "CSweep.h"         // Class header
+#include "CTrajectory.h"    // Closed form of the trajectory
+#include "CJobSystem.h"     // Job system
+#include "CBlockRunner.h"   // Blocks of runs
+#include "common.h"         // Settings struct, BallState struct
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Largest number of bins of the histogram of the bounces, one per number of bounces under it.
+    const unsigned MaxBounceBins = 1000;
+
+    // Add a result to a summary, the balls still bouncing at the time Time are not counted in the times to rest.
+    void Add (CSweep::Summary &Total, const CSweep::Result &Current, double Time)
+    {
+        ++Total.Runs;
+        Total.Bounces.Add (Current.Bounces);
+        if (Current.RestTime <= Time)
+            Total.RestTime.Add (Current.RestTime);
+        Total.FinalX.Add (Current.FinalX);
+        Total.MaxHeight.Add (Current.MaxHeight);
+
+    }// Add ()
+}
+
+// Initialize a sweep of a single run with the parameters.
+CSweep::CSweep (const Settings &Parameters, double Time) : m_Parameters (Parameters), m_Time (Time), m_ThreadCount (1)
+{
+    m_Values [SPEED].assign (1, Parameters.Speed);
+    m_Values [ANGLE].assign (1, Parameters.Angle);
+    m_Values [INIT_POS].assign (1, Parameters.InitPos);
+    m_Values [GRAVITY].assign (1, Parameters.Gravity);
+    m_Values [RESTITUTION_COEF].assign (1, Parameters.RestitutionCoef);
+
+    SetThreadCount (0);
+
+}// CSweep ()
+
+// Set the values of a field.
+void CSweep::SetValues (Field Swept, const vector <float> &Values)
+{
+    m_Values [Swept] = Values;
+
+}// SetValues ()
+
+// Set the maximum number of threads, 0 for one per core.
+void CSweep::SetThreadCount (unsigned ThreadCount)
+{
+    // The number of cores may be unknown.
+    if (ThreadCount == 0)
+        ThreadCount = thread::hardware_concurrency ();
+
+    m_ThreadCount = max (ThreadCount, 1u);
+
+    // The threads are started once, not at each run.
+    if (! m_Jobs || m_Jobs->GetThreadCount () != m_ThreadCount)
+        m_Jobs = make_shared <CJobSystem> (m_ThreadCount);
+
+}// SetThreadCount ()
+
+// Return the number of runs.
+unsigned long long CSweep::GetRunCount () const
+{
+    unsigned long long Count = 1;
+    for (unsigned i = 0; i < FIELD_COUNT; ++i)
+        Count *= m_Values [i].size ();
+
+    return Count;
+
+}// GetRunCount ()
+
+// Return the settings of a run.
+Settings CSweep::GetSettings (unsigned long long Run) const
+{
+    // The index of the run is written in a mixed base, one digit per field.
+    unsigned Digits [FIELD_COUNT];
+    for (unsigned i = 0; i < FIELD_COUNT; ++i)
+    {
+        Digits [i] = Run % m_Values [i].size ();
+        Run /= m_Values [i].size ();
+    }
+
+    Settings Parameters = m_Parameters;
+    Parameters.Speed = m_Values [SPEED][Digits [SPEED]];
+    Parameters.Angle = m_Values [ANGLE][Digits [ANGLE]];
+    Parameters.InitPos = m_Values [INIT_POS][Digits [INIT_POS]];
+    Parameters.Gravity = m_Values [GRAVITY][Digits [GRAVITY]];
+    Parameters.RestitutionCoef = m_Values [RESTITUTION_COEF][Digits [RESTITUTION_COEF]];
+    Parameters.Time = 0;
+    Parameters.TotalTime = 0;
+    Parameters.Dir = LEFTTORIGHT;
+
+    return Parameters;
+
+}// GetSettings ()
+
+// Run every combination.
+void CSweep::Run (vector <Result> &Results) const
+{
+    unsigned long long RunCount = GetRunCount ();
+    Results.resize (RunCount);
+
+    RunAll (0, RunCount, Results.data ());
+
+}// Run ()
+
+// Run a list of settings.
+void CSweep::Run (const vector <Settings> &Runs, vector <Result> &Results) const
+{
+    Results.resize (Runs.size ());
+
+    RunAll (Runs.data (), Runs.size (), Results.data ());
+
+}// Run ()
+
+// Run RunCount runs on the job system.
+void CSweep::RunAll (const Settings *Runs, unsigned long long RunCount, Result *Results) const
+{
+    // The results are all kept, their number of blocks fits in an unsigned. The threads steal the blocks left, so that
+    // the costly runs (the fast balls bouncing on the roof) are shared between them.
+    unsigned BlockCount = (unsigned) ((RunCount + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+    // The jobs only read the sweep and write to different results.
+    m_Jobs->ParallelFor (0, BlockCount, 1, [&] (unsigned FirstBlock, unsigned LastBlock)
+    {
+        RunBlocks (FirstBlock, LastBlock, Runs, RunCount, Results);
+    });
+
+}// RunAll ()
+
+// Run the blocks of runs from FirstBlock to LastBlock excluded.
+void CSweep::RunBlocks (unsigned FirstBlock, unsigned LastBlock, const Settings *Runs, unsigned long long RunCount, Result *Results) const
+{
+    unsigned long long First = FirstBlock * BLOCK_SIZE;
+    unsigned long long Last = min (RunCount, LastBlock * BLOCK_SIZE);
+
+    for (unsigned long long Run = First; Run < Last; ++Run)
+        Evaluate (Runs != 0 ? Runs [Run] : GetSettings (Run), Results [Run]);
+
+}// RunBlocks ()
+
+// Run the settings of a run.
+void CSweep::Evaluate (const Settings &Run, Result &Current) const
+{
+    CTrajectory Trajectory (Run);
+    BallState State = Trajectory.GetState (m_Time);
+
+    Current.Bounces = State.Bounces;
+    Current.RestTime = Trajectory.GetRestTime ();
+    Current.FinalX = State.X;
+    Current.MaxHeight = Trajectory.GetMaxHeight ();
+    Current.FirstImpact = Trajectory.GetFirstImpact ();
+
+}// Evaluate ()
+
+// Run every combination and sum up the results.
+void CSweep::Summarize (Summary &Total, unsigned BinCount, vector <Result> *Results/* = 0*/) const
+{
+    unsigned long long RunCount = GetRunCount ();
+    if (Results != 0)
+        Results->resize (RunCount);
+
+    CBlockRunner Runner (RunCount, m_ThreadCount);
+
+    /* BOUNDS OF THE HISTOGRAMS */
+    vector <Result> Pilot (Runner.GetPilotCount ());
+    Runner.RunPilot ([this, &Pilot] (unsigned Run, unsigned long long Item)
+    {
+        Evaluate (GetSettings (Item), Pilot [Run]);
+    });
+
+    Summary Bounds;
+    Bounds.Runs = 0;
+    for (unsigned i = 0; i < Pilot.size (); ++i)
+        Add (Bounds, Pilot [i], m_Time);
+
+    Summary Empty;
+    Empty.Runs = 0;
+    Empty.Bounces = Bounds.Bounces.GetCovering (MaxBounceBins, true);
+    Empty.RestTime = Bounds.RestTime.GetCovering (BinCount);
+    Empty.FinalX = Bounds.FinalX.GetCovering (BinCount);
+    Empty.MaxHeight = Bounds.MaxHeight.GetCovering (BinCount);
+
+    /* RUNS, ROUND AFTER ROUND */
+    Total = Empty;
+    vector <Summary> Blocks (ROUND_BLOCKS, Empty);
+
+    Runner.RunBlocks ([&] (unsigned Slot, unsigned long long Begin, unsigned long long End)
+    {
+        Summary &Block = Blocks [Slot];
+        Block.Runs = 0;
+        Block.Bounces.Clear ();
+        Block.RestTime.Clear ();
+        Block.FinalX.Clear ();
+        Block.MaxHeight.Clear ();
+
+        // The runs of the pilot are not run again.
+        for (unsigned long long Run = Begin; Run < End; ++Run)
+        {
+            Result Current;
+            unsigned Place = Runner.FindPilot (Run);
+            if (Place != NO_PILOT)
+                Current = Pilot [Place];
+            else
+                Evaluate (GetSettings (Run), Current);
+
+            Add (Block, Current, m_Time);
+            if (Results != 0)
+                (*Results) [Run] = Current;
+        }
+    },
+    [&] (unsigned Slot)
+    {
+        Total.Runs += Blocks [Slot].Runs;
+        Total.Bounces.Merge (Blocks [Slot].Bounces);
+        Total.RestTime.Merge (Blocks [Slot].RestTime);
+        Total.FinalX.Merge (Blocks [Slot].FinalX);
+        Total.MaxHeight.Merge (Blocks [Slot].MaxHeight);
+    });
+
+}// Summarize ()
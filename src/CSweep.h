@@ -0,0 +1,111 @@
+/**
+ *
+ * @file CSweep.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CSweep header file.
+ *
+ * @details Contain declaration of the class CSweep, which runs a ball for every combination of a list of values of
+ *          each field of the settings. A run is given by its index : its settings are decoded from it, so the threads
+ *          share nothing but the constant lists and write to different results. Each run uses the closed form of
+ *          the trajectory (CTrajectory) and costs about the same whatever the time it is queried at. Any list of
+ *          settings can also be run the same way. The results can be summed up without being kept : the blocks of
+ *          runs are run by rounds on a job system and merged in their order.
+ *
+ * @see CSweep.cpp
+ *
+ **/
+
+#ifndef __CSWEEP_H__
+#define __CSWEEP_H__
+
+#include <vector>       // std::vector
+#include <memory>       // std::shared_ptr
+
+#include "common.h"         // Settings struct
+#include "CStatistics.h"    // Distribution of a result
+#include "CJobSystem.h"     // Job system
+
+/*
+** CSweep class that runs the Cartesian product of lists of settings on every core.
+*/
+class CSweep
+{
+    public :
+
+        // The swept fields of the settings.
+        typedef enum{SPEED, ANGLE, INIT_POS, GRAVITY, RESTITUTION_COEF, FIELD_COUNT} Field;
+
+        // Store the result of a run.
+        struct Result
+        {
+            unsigned Bounces;           // the number of bounces at the time of the query.
+            float RestTime;             // the time the ball starts sliding on the floor, infinite if never.
+            float FinalX;               // the position of the ball on X axis at the time of the query.
+            float MaxHeight;            // the highest point reached by the ball.
+            unsigned FirstImpact;       // the walls touched first, as given by CTrajectory::GetFirstImpact ().
+        };
+
+        // Store the distributions of the results of the runs.
+        struct Summary
+        {
+            unsigned long long Runs;    // the number of runs.
+            CStatistics Bounces;        // the number of bounces at the time of the query.
+            CStatistics RestTime;       // the time the ball starts sliding on the floor, for the ones before the time of the query.
+            CStatistics FinalX;         // the position of the ball on X axis at the time of the query.
+            CStatistics MaxHeight;      // the highest point reached by the ball.
+        };
+
+        // Initialize a sweep of a single run with the parameters, queried at the time Time, with one thread per core.
+        CSweep (const nsTools::Settings &Parameters, double Time);
+
+        // Set the values of a field, the first field changes the fastest from a run to the next one. The list must not be empty.
+        void SetValues (Field Swept, const std::vector <float> &Values);
+
+        // Set the maximum number of threads, 0 for one per core. The job system running the combinations is started again with them.
+        void SetThreadCount (unsigned ThreadCount);
+
+        // Return the number of runs, the product of the numbers of values.
+        unsigned long long GetRunCount () const;
+
+        // Return the settings of a run.
+        nsTools::Settings GetSettings (unsigned long long Run) const;
+
+        // Run every combination, Results receives one result per run, in the order of the runs.
+        void Run (std::vector <Result> &Results) const;
+
+        // Run a list of settings instead of the combinations, Results receives one result per settings, in their order.
+        void Run (const std::vector <nsTools::Settings> &Runs, std::vector <Result> &Results) const;
+
+        // Run every combination and sum up the results in Total, with BinCount bins per histogram, without keeping them
+        // unless Results is not 0. The summary is the same whatever the number of threads.
+        void Summarize (Summary &Total, unsigned BinCount, std::vector <Result> *Results = 0) const;
+
+    private :
+
+        // Run RunCount runs on the job system, the settings of the run i are Runs [i], or the combination i if Runs is 0.
+        void RunAll (const nsTools::Settings *Runs, unsigned long long RunCount, Result *Results) const;
+
+        // Run the settings of a run.
+        void Evaluate (const nsTools::Settings &Run, Result &Current) const;
+
+        // Run the blocks of runs from FirstBlock to LastBlock excluded.
+        void RunBlocks (unsigned FirstBlock, unsigned LastBlock, const nsTools::Settings *Runs, unsigned long long RunCount, Result *Results) const;
+
+        // Parameters of the fields not swept, and time of the query.
+        nsTools::Settings m_Parameters;
+        double m_Time;
+
+        // Values of each field.
+        std::vector <float> m_Values [FIELD_COUNT];
+
+        // Maximum number of threads, and job system kept from a run to the next one (shared by the copies of the sweep).
+        unsigned m_ThreadCount;
+        std::shared_ptr <CJobSystem> m_Jobs;
+};
+#endif // __CSWEEP_H__
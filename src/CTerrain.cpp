@@ -0,0 +1,270 @@
+/**
+ *
+ * @file CTerrain.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CTerrain source file.
+ *
+ * @details Contain the implementation of the class CTerrain.
+ *
+ * @see CTerrain.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <string>       // std::string, std::getline
+#include <fstream>      // std::ifstream
+#include <sstream>      // std::istringstream
+#include <algorithm>    // std::min, std::max
+#include <math.h>       // sqrt
+
+#include "CTerrain.h"   // Class header
+#include "physics.h"    // CrossingComputing
+#include "common.h"     // ARENA_WIDTH
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Maximum number of levels of the hierarchy.
+    const unsigned MaxLevels = 32;
+}
+
+// Initialize a flat terrain at the height 0.
+CTerrain::CTerrain ()
+{
+    const float Flat [2] = {0, 0};
+    SetHeights (Flat, 2);
+
+}// CTerrain ()
+
+// Set the heights, spread regularly from the left wall to the right one.
+void CTerrain::SetHeights (const float *Heights, unsigned Count)
+{
+    m_Heights.assign (Heights, Heights + Count);
+
+    unsigned PieceNumber = Count - 1;
+    m_Spacing = ARENA_WIDTH / (float) PieceNumber;
+    m_InvSpacing = PieceNumber / (float) ARENA_WIDTH;
+
+    /* SLOPES AND NORMALS */
+    m_Slopes.resize (PieceNumber);
+    m_NX.resize (PieceNumber);
+    m_NY.resize (PieceNumber);
+
+    for (unsigned i = 0; i < PieceNumber; ++i)
+    {
+        m_Slopes [i] = (Heights [i + 1] - Heights [i]) * m_InvSpacing;
+
+        float Length = sqrt (1 + m_Slopes [i] * m_Slopes [i]);
+        m_NX [i] = -m_Slopes [i] / Length;
+        m_NY [i] = 1 / Length;
+    }
+
+    /* HIERARCHY OF THE HIGHEST POINTS */
+    m_Max.assign (1, vector <float> (PieceNumber));
+    for (unsigned i = 0; i < PieceNumber; ++i)
+        m_Max [0][i] = max (Heights [i], Heights [i + 1]);
+
+    // Each node covers two nodes of the previous level, the last one alone if their number is odd.
+    while (m_Max.back ().size () > 1)
+    {
+        const vector <float> &Previous = m_Max.back ();
+        vector <float> Level ((Previous.size () + 1) / 2);
+
+        for (unsigned i = 0; i < Level.size (); ++i)
+            Level [i] = 2 * i + 1 < Previous.size () ? max (Previous [2 * i], Previous [2 * i + 1]) : Previous [2 * i];
+
+        m_Max.push_back (Level);
+    }
+
+}// SetHeights ()
+
+// Read the heights of a file, separated by spaces or lines.
+bool CTerrain::Load (const char *FileName)
+{
+    ifstream File (FileName);
+    if (! File)
+        return false;
+
+    vector <float> Heights;
+    string Line;
+    while (getline (File, Line))
+    {
+        // Remove the comment.
+        string::size_type Comment = Line.find ('#');
+        if (Comment != string::npos)
+            Line.erase (Comment);
+
+        istringstream Values (Line);
+        float Height;
+        while (Values >> Height)
+            Heights.push_back (Height);
+
+        if (! Values.eof ())
+            return false;
+    }
+
+    if (Heights.size () < 2)
+        return false;
+
+    SetHeights (Heights.data (), Heights.size ());
+
+    return true;
+
+}// Load ()
+
+// Return the number of heights.
+unsigned CTerrain::GetHeightCount () const
+{
+    return m_Heights.size ();
+
+}// GetHeightCount ()
+
+// Return the piece of the terrain under the abscissa X.
+unsigned CTerrain::GetPiece (float X) const
+{
+    if (X <= 0)
+        return 0;
+
+    unsigned Piece = (unsigned) (X * m_InvSpacing);
+
+    return Piece < m_Slopes.size () ? Piece : m_Slopes.size () - 1;
+
+}// GetPiece ()
+
+// Return the height of the terrain at the abscissa X.
+float CTerrain::GetHeight (float X) const
+{
+    unsigned Piece = GetPiece (X);
+
+    return m_Heights [Piece] + m_Slopes [Piece] * (X - Piece * m_Spacing);
+
+}// GetHeight ()
+
+// Give the unit normal of the terrain at the abscissa X.
+void CTerrain::GetNormal (float X, float &NX, float &NY) const
+{
+    unsigned Piece = GetPiece (X);
+
+    NX = m_NX [Piece];
+    NY = m_NY [Piece];
+
+}// GetNormal ()
+
+// Find the first time before MaxTime the ball touches the terrain.
+bool CTerrain::FirstImpact (double X, double Y, double VelX, double VelY, double Gravity, double MaxTime, double &Time, float &NX, float &NY) const
+{
+    // The smallest node covering the pieces under the arc : the first and the last piece have the same parent there.
+    double EndX = X + VelX * MaxTime;
+    unsigned FirstPiece = GetPiece (min (X, EndX));
+    unsigned LastPiece = GetPiece (max (X, EndX));
+    unsigned Top = 0;
+    while ((FirstPiece >> Top) != (LastPiece >> Top))
+        ++Top;
+
+    // The parabola is the lowest at one of its ends : a ball staying above the highest point of the node does not touch anything.
+    if (min (Y, Y + (VelY - 0.5 * Gravity * MaxTime) * MaxTime) > m_Max [Top][FirstPiece >> Top])
+        return false;
+
+    // Nodes to visit, the closest one to the ball on the top : the first piece touched is the first one reached.
+    unsigned Levels [2 * MaxLevels];
+    unsigned Nodes [2 * MaxLevels];
+    unsigned StackSize = 0;
+
+    Levels [StackSize] = Top;
+    Nodes [StackSize++] = FirstPiece >> Top;
+
+    while (StackSize > 0)
+    {
+        --StackSize;
+        unsigned Level = Levels [StackSize];
+        unsigned Node = Nodes [StackSize];
+
+        /* TIMES THE BALL IS OVER THE NODE */
+        unsigned FirstPiece = Node << Level;
+        unsigned LastPiece = min ((Node + 1) << Level, (unsigned) m_Slopes.size ());
+        double Left = FirstPiece * (double) m_Spacing;
+        double Right = LastPiece * (double) m_Spacing;
+
+        // The ends of the terrain go on along the walls.
+        if (FirstPiece == 0)
+            Left = -1e30;
+        if (LastPiece == m_Slopes.size ())
+            Right = 1e30;
+
+        double Enter = 0;
+        double Leave = MaxTime;
+        if (VelX > 0)
+        {
+            Enter = max (Enter, (Left - X) / VelX);
+            Leave = min (Leave, (Right - X) / VelX);
+        }
+        else if (VelX < 0)
+        {
+            Enter = max (Enter, (Right - X) / VelX);
+            Leave = min (Leave, (Left - X) / VelX);
+        }
+        else if (X < Left || X > Right)
+            continue;
+
+        if (Enter > Leave)
+            continue;
+
+        // Same test as for the whole terrain, on the part of the parabola over the node.
+        double EnterY = Y + (VelY - 0.5 * Gravity * Enter) * Enter;
+        double LeaveY = Y + (VelY - 0.5 * Gravity * Leave) * Leave;
+        if (min (EnterY, LeaveY) > m_Max [Level][Node])
+            continue;
+
+        /* PIECE, EXACT CROSSING OF THE PARABOLA WITH ITS LINE */
+        if (Level == 0)
+        {
+            // Height of the ball over the line : A * t * t + B * t + C.
+            double A = -0.5 * Gravity;
+            double B = VelY - m_Slopes [Node] * VelX;
+            double C = Y - m_Heights [Node] - m_Slopes [Node] * (X - Left);
+            if (FirstPiece == 0)
+                C = Y - m_Heights [0] - m_Slopes [0] * X;
+
+            // A ball already under the piece and not going out touches it now.
+            double Crossing;
+            if (Enter == 0 && C <= 0 && B <= 0)
+                Crossing = 0;
+            else
+                Crossing = CrossingComputing (A, B, C, false);
+
+            if (Crossing >= Enter && Crossing <= Leave)
+            {
+                Time = Crossing;
+                NX = m_NX [Node];
+                NY = m_NY [Node];
+                return true;
+            }
+
+            continue;
+        }
+
+        /* CHILDREN, THE FARTHEST ONE FIRST ON THE STACK */
+        unsigned Child = 2 * Node;
+        bool Single = Child + 1 >= m_Max [Level - 1].size ();
+        bool LeftFirst = VelX >= 0;
+
+        if (! Single)
+        {
+            Levels [StackSize] = Level - 1;
+            Nodes [StackSize++] = LeftFirst ? Child + 1 : Child;
+        }
+        Levels [StackSize] = Level - 1;
+        Nodes [StackSize++] = LeftFirst || Single ? Child : Child + 1;
+    }
+
+    return false;
+
+}// FirstImpact ()
@@ -0,0 +1,75 @@
+/**
+ *
+ * @file CTerrain.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CTerrain header file.
+ *
+ * @details Contain declaration of the class CTerrain, an uneven floor given by heights spread regularly over the width of the arena.
+ *          The slopes and the normals of the pieces between two heights are computed once. A hierarchy of the highest points
+ *          of the pieces, like the mip levels of a texture, finds the first piece under the arc of the ball. A ball above
+ *          the highest point costs a single compare, as the flat floor.
+ *
+ * @see CTerrain.cpp
+ *
+ **/
+
+#ifndef __CTERRAIN_H__
+#define __CTERRAIN_H__
+
+#include <vector>       // std::vector
+
+/*
+** CTerrain class that finds where the ball touches an uneven floor.
+*/
+class CTerrain
+{
+    public :
+
+        // Initialize a flat terrain at the height 0.
+        CTerrain ();
+
+        // Set the heights, spread regularly from the left wall to the right one. At least two heights are needed.
+        void SetHeights (const float *Heights, unsigned Count);
+
+        // Read the heights of a file, separated by spaces or lines, '#' starts a comment.
+        // Return false if the file can not be read or holds less than two heights.
+        bool Load (const char *FileName);
+
+        // Return the number of heights.
+        unsigned GetHeightCount () const;
+
+        // Return the height of the terrain at the abscissa X.
+        float GetHeight (float X) const;
+
+        // Give the unit normal of the terrain at the abscissa X, going up.
+        void GetNormal (float X, float &NX, float &NY) const;
+
+        // Find the first time before MaxTime the ball at (X, Y) with the velocity (VelX, VelY) and falling with Gravity
+        // touches the terrain, and the normal there. Return false if it does not touch it.
+        bool FirstImpact (double X, double Y, double VelX, double VelY, double Gravity, double MaxTime, double &Time, float &NX, float &NY) const;
+
+    private :
+
+        // Return the piece of the terrain under the abscissa X.
+        unsigned GetPiece (float X) const;
+
+        // Heights, and slope and unit normal of each piece between two heights.
+        std::vector <float> m_Heights;
+        std::vector <float> m_Slopes;
+        std::vector <float> m_NX;
+        std::vector <float> m_NY;
+
+        // Width of a piece and its inverse.
+        float m_Spacing;
+        float m_InvSpacing;
+
+        // Highest point of the pieces, level 0 for each piece then each level for the pairs of nodes of the previous one.
+        std::vector <std::vector <float> > m_Max;
+};
+#endif // __CTERRAIN_H__
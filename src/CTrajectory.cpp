@@ -0,0 +1,420 @@
+/**
+ *
+ * @file CTrajectory.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CTrajectory source file.
+ *
+ * @details Contain the implementation of the class CTrajectory.
+ *
+ * @see CTrajectory.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <limits>       // std::numeric_limits
+#include <algorithm>    // std::min, std::max
+#include <math.h>       // fabs, floor, ceil, fmod, log, pow, sqrt
+
+#include "CTrajectory.h"    // Class header
+#include "physics.h"        // CrossingComputing, RestComputing
+#include "fastmath.h"       // FastSinCos
+#include "common.h"         // Settings struct, BallState struct, ARENA sizes, REST thresholds, SLIDE_FRICTION
+
+using namespace std;
+using namespace nsTools;
+
+// Prepare the trajectory of a ball launched with the parameters (the gravity must not be negative).
+CTrajectory::CTrajectory (const Settings &Parameters) : m_RestitutionCoef (min (Parameters.RestitutionCoef, 1.0f)),
+                                                        m_Gravity (Parameters.Gravity), m_Period (0),
+                                                        m_SeriesTime (0), m_SeriesSpeed (0),
+                                                        m_SeriesBounces (0), m_SeriesLength (0), m_RestBounces (0),
+                                                        m_RestTime (numeric_limits <double>::infinity ()),
+                                                        m_Friction (SLIDE_FRICTION * Parameters.Gravity), m_SlideImpacts (0),
+                                                        m_StopTime (numeric_limits <double>::infinity ()),
+                                                        m_LandingTime (numeric_limits <double>::infinity ()), m_MaxHeight (Parameters.InitPos)
+{
+    float Sin;
+    float Cos;
+    FastSinCos (Parameters.Angle, Sin, Cos);
+
+    double VelX = Parameters.Speed * Cos;
+    double VelY = Parameters.Speed * Sin;
+
+    PrepareAxis (m_Horizontal, 0, VelX, ARENA_WIDTH);
+    PrepareAxis (m_Vertical, Parameters.InitPos, VelY, ARENA_HEIGHT);
+
+    // Without gravity the vertical motion is the same as the horizontal one.
+    if (m_Gravity <= 0)
+    {
+        if (VelY != 0)
+            m_MaxHeight = ARENA_HEIGHT;
+        if (VelY < 0)
+            m_LandingTime = m_Vertical.FirstImpact;
+        return;
+    }
+
+    // Follow the ball impact after impact until its bounces on the floor can't reach the roof anymore.
+    Segment Current = {0, Parameters.InitPos, VelY};
+    m_Segments.push_back (Current);
+
+    for (;;)
+    {
+        // The top of the flight, under the roof.
+        if (Current.Velocity > 0)
+            m_MaxHeight = max (m_MaxHeight, min ((double) ARENA_HEIGHT, Current.Position + Current.Velocity * Current.Velocity / (2 * m_Gravity)));
+
+        double Floor = CrossingComputing (-0.5 * m_Gravity, Current.Velocity, Current.Position, false);
+        double Roof = CrossingComputing (-0.5 * m_Gravity, Current.Velocity, Current.Position - ARENA_HEIGHT, true);
+
+        // Bounce on the roof and start a new segment.
+        if (Roof >= 0 && (Floor < 0 || Roof < Floor))
+        {
+            double Velocity = Current.Velocity - m_Gravity * Roof;
+            Current.Time += Roof;
+            Current.Position = ARENA_HEIGHT;
+            Current.Velocity = -fabs (Velocity) * m_RestitutionCoef;
+            m_Segments.push_back (Current);
+            continue;
+        }
+
+        double Velocity = fabs (Current.Velocity - m_Gravity * Floor) * m_RestitutionCoef;
+        Current.Time += Floor;
+        m_LandingTime = min (m_LandingTime, Current.Time);
+
+        // The bounces are low enough, the floor bounces series begins here.
+        if (Velocity < REST_SPEED || Velocity * Velocity <= 2 * m_Gravity * ARENA_HEIGHT)
+        {
+            m_SeriesTime = Current.Time;
+            m_SeriesSpeed = Velocity;
+            m_SeriesBounces = m_Segments.size ();
+            m_MaxHeight = max (m_MaxHeight, Velocity * Velocity / (2 * m_Gravity));
+            break;
+        }
+
+        Current.Position = 0;
+        Current.Velocity = Velocity;
+        m_Segments.push_back (Current);
+
+        // Without any loss the ball goes up to the roof and back to the floor at the same speed forever, one cycle is enough.
+        if (m_RestitutionCoef >= 1)
+        {
+            double Rise = CrossingComputing (-0.5 * m_Gravity, Velocity, -ARENA_HEIGHT, true);
+            double RoofVelocity = -fabs (Velocity - m_Gravity * Rise);
+            double Fall = CrossingComputing (-0.5 * m_Gravity, RoofVelocity, ARENA_HEIGHT, false);
+
+            Segment Roof = {Current.Time + Rise, ARENA_HEIGHT, RoofVelocity};
+            m_Segments.push_back (Roof);
+            m_MaxHeight = ARENA_HEIGHT;
+            m_Period = Rise + Fall;
+            m_SeriesTime = numeric_limits <double>::infinity ();
+            return;
+        }
+    }
+
+    // The upward speed after k bounces of the series is m_SeriesSpeed * e^k, the flights are followed until one is shorter than REST_FLIGHT_TIME.
+    if (RestComputing (m_SeriesSpeed, m_Gravity, m_RestitutionCoef, REST_FLIGHT_TIME, m_RestBounces) < 0)
+    {
+        if (m_RestitutionCoef >= 1)
+            return;
+
+        double Length = ceil (log (m_Gravity * REST_FLIGHT_TIME / (2 * m_SeriesSpeed)) / log (m_RestitutionCoef));
+        if (Length < 1)
+            Length = 1;
+
+        m_SeriesLength = (unsigned) Length;
+        while (m_SeriesLength > 1 && RestComputing (m_SeriesSpeed * pow (m_RestitutionCoef, m_SeriesLength - 1), m_Gravity,
+                                                    m_RestitutionCoef, REST_FLIGHT_TIME, m_RestBounces) >= 0)
+            --m_SeriesLength;
+        while (RestComputing (m_SeriesSpeed * pow (m_RestitutionCoef, m_SeriesLength), m_Gravity,
+                              m_RestitutionCoef, REST_FLIGHT_TIME, m_RestBounces) < 0)
+            ++m_SeriesLength;
+    }
+
+    // The flight k lasts 2 * m_SeriesSpeed * e^k / g, the durations form a geometric series. The ball then slides on the floor.
+    m_RestTime = m_SeriesTime + 2 * m_SeriesSpeed / m_Gravity * (1 - pow (m_RestitutionCoef, m_SeriesLength)) / (1 - m_RestitutionCoef);
+
+    // As in CSimulation, the sliding ball is slowed down by the friction. It loses the square of its speed in proportion to the
+    // distance slid, so it is followed from wall to wall until it stops : a crossing costs 2 * friction * width of it.
+    double RestX;
+    double RestVelX;
+    AxisState (m_Horizontal, m_RestTime, RestX, RestVelX, m_SlideImpacts);
+
+    Segment Slide = {m_RestTime, RestX, RestVelX};
+    m_Slides.push_back (Slide);
+
+    for (;;)
+    {
+        double Speed = fabs (Slide.Velocity);
+        double Distance = Slide.Velocity > 0 ? ARENA_WIDTH - Slide.Position : Slide.Position;
+        double Left = Speed * Speed - 2 * m_Friction * Distance;
+        if (Speed == 0 || Left <= 0)
+        {
+            m_StopTime = Slide.Time + Speed / m_Friction;
+            break;
+        }
+
+        Left = sqrt (Left);
+        Slide.Time += (Speed - Left) / m_Friction;
+        Slide.Position = Slide.Velocity > 0 ? ARENA_WIDTH : 0;
+        Slide.Velocity = (Slide.Velocity > 0 ? -Left : Left) * m_RestitutionCoef;
+        m_Slides.push_back (Slide);
+    }
+
+}// CTrajectory ()
+
+// Prepare the motion on one axis between two walls.
+void CTrajectory::PrepareAxis (LinearAxis &Axis, double Position, double Velocity, double Length)
+{
+    Axis.Position = Position;
+    Axis.Velocity = Velocity;
+    Axis.Length = Length;
+
+    if (Velocity > 0)
+        Axis.FirstImpact = (Length - Position) / Velocity;
+    else if (Velocity < 0)
+        Axis.FirstImpact = Position / -Velocity;
+    else
+        Axis.FirstImpact = -1;
+
+    Axis.Crossing = Velocity != 0 ? Length / fabs (Velocity) : 0;
+
+}// PrepareAxis ()
+
+// Compute the position, velocity and number of impacts on one axis between two walls.
+void CTrajectory::AxisState (const LinearAxis &Axis, double Time, double &Position, double &Velocity, unsigned &Impacts) const
+{
+    // Before the first impact.
+    if (Axis.FirstImpact < 0 || Time < Axis.FirstImpact)
+    {
+        Position = Axis.Position + Axis.Velocity * Time;
+        Velocity = Axis.Velocity;
+        Impacts = 0;
+        return;
+    }
+
+    double First = Axis.Velocity > 0 ? Axis.Length : 0;
+    double Elapsed = Time - Axis.FirstImpact;
+    double Coef = m_RestitutionCoef;
+
+    // The ball stays against the first wall.
+    if (Coef <= 0)
+    {
+        Position = First;
+        Velocity = 0;
+        Impacts = 1;
+        return;
+    }
+
+    // The k-th crossing after the first impact lasts Crossing / e^k, so k crossings last Crossing * (e^-k - 1) / (1 - e).
+    double Crossings;
+    if (Coef >= 1)
+        Crossings = floor (Elapsed / Axis.Crossing);
+    else
+        Crossings = floor (log (1 + Elapsed * (1 - Coef) / Axis.Crossing) / -log (Coef));
+
+    if (Crossings < 0)
+        Crossings = 0;
+
+    // Correct the rounding errors of the logarithm at the boundaries.
+    double Start = Coef >= 1 ? Crossings * Axis.Crossing : Axis.Crossing * (pow (Coef, -Crossings) - 1) / (1 - Coef);
+    if (Start > Elapsed && Crossings > 0)
+    {
+        --Crossings;
+        Start = Coef >= 1 ? Crossings * Axis.Crossing : Axis.Crossing * (pow (Coef, -Crossings) - 1) / (1 - Coef);
+    }
+    else if (Elapsed - Start >= Axis.Crossing * pow (Coef, -(Crossings + 1)))
+    {
+        Start += Axis.Crossing * pow (Coef, -(Crossings + 1));
+        ++Crossings;
+    }
+
+    // The ball leaves the last touched wall with the speed reduced by each impact.
+    double Wall = fmod (Crossings, 2) == 0 ? First : Axis.Length - First;
+    double Speed = fabs (Axis.Velocity) * pow (Coef, Crossings + 1);
+
+    Velocity = Wall == 0 ? Speed : -Speed;
+    Position = Wall + Velocity * (Elapsed - Start);
+    if (Position < 0)
+        Position = 0;
+    else if (Position > Axis.Length)
+        Position = Axis.Length;
+
+    Impacts = (unsigned) Crossings + 1;
+
+}// AxisState ()
+
+// Return the state of the ball at the time Time.
+BallState CTrajectory::GetState (double Time) const
+{
+    BallState State;
+    double X;
+    double Y;
+    double VelX;
+    double VelY;
+    unsigned ImpactsX;
+    unsigned ImpactsY;
+
+    State.Resting = false;
+
+    if (Time < m_RestTime)
+        AxisState (m_Horizontal, Time, X, VelX, ImpactsX);
+    else
+    {
+        // Last crossing of the slide started before the time, the ball does not move once stopped.
+        unsigned Index = m_Slides.size () - 1;
+        while (Index > 0 && m_Slides [Index].Time > Time)
+            --Index;
+
+        const Segment &Slide = m_Slides [Index];
+        double Friction = Slide.Velocity > 0 ? m_Friction : -m_Friction;
+        double Elapsed = min (Time, m_StopTime) - Slide.Time;
+        X = Slide.Position + Slide.Velocity * Elapsed - 0.5 * Friction * Elapsed * Elapsed;
+        VelX = Time < m_StopTime ? Slide.Velocity - Friction * Elapsed : 0;
+        ImpactsX = m_SlideImpacts + Index;
+    }
+
+    if (m_Gravity <= 0)
+        AxisState (m_Vertical, Time, Y, VelY, ImpactsY);
+    else if (Time < m_SeriesTime)
+    {
+        // The cycles of the periodic motion are taken back to the first one, two impacts each.
+        double Local = Time;
+        double Cycles = 0;
+        if (m_Period > 0 && Time >= m_Segments [m_Segments.size () - 2].Time)
+        {
+            Cycles = floor ((Time - m_Segments [m_Segments.size () - 2].Time) / m_Period);
+            Local -= Cycles * m_Period;
+        }
+
+        // Last segment started before the time.
+        unsigned Index = m_Segments.size () - 1;
+        while (Index > 0 && m_Segments [Index].Time > Local)
+            --Index;
+
+        double Elapsed = Local - m_Segments [Index].Time;
+        Y = m_Segments [Index].Position + m_Segments [Index].Velocity * Elapsed - 0.5 * m_Gravity * Elapsed * Elapsed;
+        VelY = m_Segments [Index].Velocity - m_Gravity * Elapsed;
+        ImpactsY = Index + 2 * (unsigned) Cycles;
+    }
+    else if (Time >= m_RestTime)
+    {
+        Y = 0;
+        VelY = 0;
+        ImpactsY = m_SeriesBounces + m_SeriesLength + m_RestBounces;
+        State.Resting = true;
+    }
+    else
+    {
+        // Flight of the series containing the time, the k first flights last 2 * Speed / g * (1 - e^k) / (1 - e).
+        double Coef = m_RestitutionCoef;
+        double Elapsed = Time - m_SeriesTime;
+        double Flight = 2 * m_SeriesSpeed / m_Gravity;
+        double Index;
+
+        if (Coef >= 1)
+            Index = floor (Elapsed / Flight);
+        else
+            Index = floor (log (1 - Elapsed * (1 - Coef) / Flight) / log (Coef));
+
+        if (! (Index >= 0))
+            Index = 0;
+        if (Coef < 1 && Index > m_SeriesLength - 1)
+            Index = m_SeriesLength - 1;
+
+        double Start = Coef >= 1 ? Index * Flight : Flight * (1 - pow (Coef, Index)) / (1 - Coef);
+        double Speed = m_SeriesSpeed * pow (Coef, Index);
+        double Local = Elapsed - Start;
+        if (Local < 0)
+            Local = 0;
+
+        Y = Speed * Local - 0.5 * m_Gravity * Local * Local;
+        if (Y < 0)
+            Y = 0;
+        VelY = Speed - m_Gravity * Local;
+        ImpactsY = m_SeriesBounces + (unsigned) Index;
+    }
+
+    State.X = X;
+    State.Y = Y;
+    State.VelX = VelX;
+    State.VelY = VelY;
+    State.Bounces = ImpactsX + ImpactsY;
+
+    return State;
+
+}// GetState ()
+
+// Compute the state of the ball at Count times.
+void CTrajectory::GetStates (const double *Times, BallState *States, unsigned Count) const
+{
+    // Every time is independent of the others, no need to sort them.
+    for (unsigned i = 0; i < Count; ++i)
+        States [i] = GetState (Times [i]);
+
+}// GetStates ()
+
+// Return the time when the bounces on the floor become too small to be followed and the ball slides.
+double CTrajectory::GetRestTime () const
+{
+    return m_RestTime;
+
+}// GetRestTime ()
+
+// Return the time when the friction stops the ball sliding on the floor.
+double CTrajectory::GetStopTime () const
+{
+    return m_StopTime;
+
+}// GetStopTime ()
+
+// Return the highest point the ball reaches.
+double CTrajectory::GetMaxHeight () const
+{
+    return m_MaxHeight;
+
+}// GetMaxHeight ()
+
+// Return the time of the first impact on the floor.
+double CTrajectory::GetLandingTime () const
+{
+    return m_LandingTime;
+
+}// GetLandingTime ()
+
+// Return the walls touched first.
+unsigned CTrajectory::GetFirstImpact () const
+{
+    // The first vertical impact is the end of the first segment : on the roof if a segment follows from it, else on the floor.
+    double Vertical = m_LandingTime;
+    unsigned VerticalWall = COLLISION_BOTTOM;
+    if (m_Gravity <= 0)
+    {
+        Vertical = m_Vertical.FirstImpact;
+        VerticalWall = m_Vertical.Velocity > 0 ? COLLISION_TOP : COLLISION_BOTTOM;
+    }
+    else if (m_Segments.size () > 1 && m_Segments [1].Position >= ARENA_HEIGHT)
+    {
+        Vertical = m_Segments [1].Time;
+        VerticalWall = COLLISION_TOP;
+    }
+
+    double Horizontal = m_Horizontal.FirstImpact;
+    unsigned HorizontalWall = m_Horizontal.Velocity > 0 ? COLLISION_RIGHT : COLLISION_LEFT;
+
+    // A negative time is an impact that never happens, a corner is touched by both axes at once.
+    if (Horizontal < 0 && Vertical < 0)
+        return 0;
+    if (Vertical < 0 || (Horizontal >= 0 && Horizontal < Vertical))
+        return HorizontalWall;
+    if (Horizontal < 0 || Vertical < Horizontal)
+        return VerticalWall;
+
+    return HorizontalWall | VerticalWall;
+
+}// GetFirstImpact ()
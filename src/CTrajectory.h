@@ -0,0 +1,126 @@
+/**
+ *
+ * @file CTrajectory.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CTrajectory header file.
+ *
+ * @details Contain declaration of the class CTrajectory, the closed form of a whole trajectory.
+ *          As only the normal component of the velocity is reduced at each bounce, the horizontal and
+ *          vertical motions are independent and the durations between bounces form geometric series.
+ *          The state of the ball at any time is then computed without going through the previous bounces.
+ *          Without any loss (coefficient of restitution 1, higher ones are taken as 1), a ball reaching the roof
+ *          goes back and forth between the floor and the roof forever : that motion is periodic.
+ *
+ * @see CTrajectory.cpp
+ *
+ **/
+
+#ifndef __CTRAJECTORY_H__
+#define __CTRAJECTORY_H__
+
+#include <vector>       // std::vector
+
+#include "common.h"     // Settings struct, BallState struct
+
+/*
+** CTrajectory class that gives the state of the ball at any time.
+*/
+class CTrajectory
+{
+    public :
+
+        // Prepare the trajectory of a ball launched with the parameters (the gravity must not be negative, the coefficient of
+        // restitution not above 1).
+        CTrajectory (const nsTools::Settings &Parameters);
+
+        // Return the state of the ball at the time Time.
+        nsTools::BallState GetState (double Time) const;
+
+        // Compute the state of the ball at Count times.
+        void GetStates (const double *Times, nsTools::BallState *States, unsigned Count) const;
+
+        // Return the time when the bounces on the floor become too small to be followed and the ball slides.
+        double GetRestTime () const;
+
+        // Return the time when the friction stops the ball sliding on the floor, infinite if it never slides.
+        double GetStopTime () const;
+
+        // Return the highest point the ball reaches.
+        double GetMaxHeight () const;
+
+        // Return the time of the first impact on the floor, infinite if the ball never touches it.
+        double GetLandingTime () const;
+
+        // Return the walls touched first (COLLISION_ codes, two of them for a corner), 0 if the ball never touches any.
+        unsigned GetFirstImpact () const;
+
+    private :
+
+        // Store the motion on one axis between two walls, at a constant speed reduced at each wall.
+        struct LinearAxis
+        {
+            double Position;        // the initial position.
+            double Velocity;        // the initial velocity.
+            double Length;          // the distance between the walls.
+            double FirstImpact;     // the time of the first impact (negative if never).
+            double Crossing;        // the duration of a crossing at the initial speed.
+        };
+
+        // Store a part of the vertical motion computed impact after impact (while the roof can be touched),
+        // or a crossing of the ball sliding on the floor from wall to wall.
+        struct Segment
+        {
+            double Time;            // the time of the beginning of the segment.
+            double Position;        // the initial position.
+            double Velocity;        // the initial velocity.
+        };
+
+        // Prepare the motion on one axis between two walls.
+        void PrepareAxis (LinearAxis &Axis, double Position, double Velocity, double Length);
+
+        // Compute the position, velocity and number of impacts on one axis between two walls.
+        void AxisState (const LinearAxis &Axis, double Time, double &Position, double &Velocity, unsigned &Impacts) const;
+
+        // Coefficient of restitution and gravity.
+        double m_RestitutionCoef;
+        double m_Gravity;
+
+        // Horizontal motion, and vertical motion if there is no gravity.
+        LinearAxis m_Horizontal;
+        LinearAxis m_Vertical;
+
+        // Vertical motion before the floor bounces series.
+        std::vector <Segment> m_Segments;
+
+        // Duration of a floor to floor cycle through the roof, repeating the two last segments forever, 0 if the ball loses speed.
+        double m_Period;
+
+        // Floor bounces series : start time, upward speed after the first bounce, number of bounces before.
+        double m_SeriesTime;
+        double m_SeriesSpeed;
+        unsigned m_SeriesBounces;
+
+        // Number of followed bounces of the series, number of bounces too small to be followed and time when the ball stops bouncing.
+        unsigned m_SeriesLength;
+        unsigned m_RestBounces;
+        double m_RestTime;
+
+        // Slide on the floor from m_RestTime : deceleration, impacts on the walls before, crossings and time when the ball stops.
+        double m_Friction;
+        unsigned m_SlideImpacts;
+        std::vector <Segment> m_Slides;
+        double m_StopTime;
+
+        // Time of the first impact on the floor.
+        double m_LandingTime;
+
+        // Highest point of the trajectory.
+        double m_MaxHeight;
+};
+#endif // __CTRAJECTORY_H__
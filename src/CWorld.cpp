@@ -0,0 +1,1265 @@
+/**
+ *
+ * @file CWorld.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CWorld source file.
+ *
+ * @details Contain the implementation of the class CWorld.
+ *
+ * @see CWorld.h
+ *
+ **/
+
+#include <vector>       // std::vector
+#include <utility>      // std::pair, std::swap
+#include <math.h>       // sqrt, fabs
+#include <algorithm>    // std::min, std::max, std::sort
+
+#include "CWorld.h"     // Class header
+#include "physics.h"    // Trajectory and collision functions
+#include "batch.h"      // Batched trajectory and collision functions
+#include "fastmath.h"   // FastSinCos
+#include "CGrid.h"      // Uniform grid
+#include "CContactSolver.h" // Contact solver
+#include "CLinkSolver.h"    // Link solver
+#include "CSegmentTree.h"   // Static segments
+#include "CTerrain.h"       // Uneven floor
+#include "CForceField.h"    // Force field
+#include "common.h"     // Settings struct, PI, REST and SLEEP thresholds, SURFACE_SKIN
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // The balls of a pile asleep closer than this part of the diameter wake up together.
+    const float WakeDistance = 1.05f;
+}
+
+// Initialize an empty world.
+CWorld::CWorld () : m_ActiveCount (0), m_Radius (0), m_SolveContacts (false), m_Segments (0), m_Terrain (0), m_Field (0), m_Jobs (0), m_CollisionCount (0), m_TotalTime (0)
+{
+
+}// CWorld ()
+
+// Reserve memory for BallNumber balls.
+void CWorld::Reserve (unsigned BallNumber)
+{
+    m_PosX.reserve (BallNumber);
+    m_PosY.reserve (BallNumber);
+    m_VelX.reserve (BallNumber);
+    m_VelY.reserve (BallNumber);
+    m_OriginX.reserve (BallNumber);
+    m_OriginY.reserve (BallNumber);
+    m_Time.reserve (BallNumber);
+    m_Gravity.reserve (BallNumber);
+    m_BallGravity.reserve (BallNumber);
+    m_RestitutionCoef.reserve (BallNumber);
+    m_BounceCount.reserve (BallNumber);
+    m_Resting.reserve (BallNumber);
+    m_StillTime.reserve (BallNumber);
+    m_Slot.reserve (BallNumber);
+    m_Ball.reserve (BallNumber);
+    m_Removed.reserve (BallNumber);
+    m_Stopped.reserve (BallNumber);
+    m_Woken.reserve (BallNumber);
+    m_SolveVelX.reserve (BallNumber);
+    m_SolveVelY.reserve (BallNumber);
+    m_Marked.reserve (BallNumber);
+    m_FromX.reserve (BallNumber);
+    m_FromY.reserve (BallNumber);
+
+}// Reserve ()
+
+// Remove every ball.
+void CWorld::Clear ()
+{
+    m_PosX.clear ();
+    m_PosY.clear ();
+    m_VelX.clear ();
+    m_VelY.clear ();
+    m_OriginX.clear ();
+    m_OriginY.clear ();
+    m_Time.clear ();
+    m_Gravity.clear ();
+    m_BallGravity.clear ();
+    m_RestitutionCoef.clear ();
+    m_BounceCount.clear ();
+    m_Resting.clear ();
+    m_StillTime.clear ();
+    m_Slot.clear ();
+    m_Ball.clear ();
+    m_Removed.clear ();
+    m_FromX.clear ();
+    m_FromY.clear ();
+    m_Solver.Clear ();
+    m_Links.Clear ();
+    m_ActiveCount = 0;
+    m_CollisionCount = 0;
+    m_TotalTime = 0;
+
+}// Clear ()
+
+// Add a ball launched with the parameters from the abscissa X, return its handle.
+unsigned CWorld::AddBall (const Settings &Parameters, float X/* = 0*/)
+{
+    // Every index is used, or retired after its last generation.
+    if (m_Removed.empty () && m_Slot.size () >= WORLD_MAX_BALLS)
+        return WORLD_NO_BALL;
+
+    m_PosX.push_back (X);
+    m_PosY.push_back (Parameters.InitPos);
+    float Sin;
+    float Cos;
+    FastSinCos (Parameters.Angle, Sin, Cos);
+
+    m_VelX.push_back (Parameters.Speed * Cos);
+    m_VelY.push_back (Parameters.Speed * Sin);
+    m_OriginX.push_back (X);
+    m_OriginY.push_back (Parameters.InitPos);
+    m_Time.push_back (0);
+    m_Gravity.push_back (Parameters.Gravity);
+    m_BallGravity.push_back (Parameters.Gravity);
+    m_RestitutionCoef.push_back (Parameters.RestitutionCoef);
+    m_BounceCount.push_back (0);
+    m_Resting.push_back (false);
+    m_StillTime.push_back (0);
+
+    // The index of the last ball removed is reused, with the next generation of handle.
+    unsigned Ball;
+    unsigned Slot = m_Ball.size ();
+    if (m_Removed.empty ())
+    {
+        Ball = m_Slot.size ();
+        m_Slot.push_back (Slot);
+    }
+    else
+    {
+        Ball = m_Removed.back () + (1u << WORLD_INDEX_BITS);
+        m_Removed.pop_back ();
+        m_Slot [Ball & WORLD_INDEX_MASK] = Slot;
+    }
+    m_Ball.push_back (Ball);
+
+    // The new ball is active, it takes the place of the first sleeping one.
+    Swap (Slot, m_ActiveCount);
+    ++m_ActiveCount;
+
+    return Ball;
+
+}// AddBall ()
+
+// Remove a ball, return false if the handle is not the one of a ball of the world anymore.
+bool CWorld::RemoveBall (unsigned Ball)
+{
+    if (! IsAlive (Ball))
+        return false;
+
+    // An active ball leaves its slot to the last active one, so that the active balls stay in the first slots.
+    unsigned Slot = GetSlot (Ball);
+    if (Slot < m_ActiveCount)
+    {
+        --m_ActiveCount;
+        Swap (Slot, m_ActiveCount);
+        Slot = m_ActiveCount;
+    }
+
+    // Then to the last ball, the arrays lose their last element without moving the others.
+    Swap (Slot, m_Ball.size () - 1);
+
+    m_PosX.pop_back ();
+    m_PosY.pop_back ();
+    m_VelX.pop_back ();
+    m_VelY.pop_back ();
+    m_OriginX.pop_back ();
+    m_OriginY.pop_back ();
+    m_Time.pop_back ();
+    m_Gravity.pop_back ();
+    m_BallGravity.pop_back ();
+    m_RestitutionCoef.pop_back ();
+    m_BounceCount.pop_back ();
+    m_Resting.pop_back ();
+    m_StillTime.pop_back ();
+    m_Ball.pop_back ();
+
+    // The next generation would wrap back to the first handle of the index, which may still be held : the index is retired.
+    m_Slot [Ball & WORLD_INDEX_MASK] = m_Ball.size ();
+    if ((Ball >> WORLD_INDEX_BITS) < (WORLD_NO_BALL >> WORLD_INDEX_BITS))
+        m_Removed.push_back (Ball);
+
+    // Its links go with it, they have to be looked for.
+    if (m_Links.GetLinkCount () > 0)
+        m_Links.RemoveBody (Ball & WORLD_INDEX_MASK);
+
+    return true;
+
+}// RemoveBall ()
+
+// Tells if the handle is the one of a ball of the world.
+bool CWorld::IsAlive (unsigned Ball) const
+{
+    unsigned Index = Ball & WORLD_INDEX_MASK;
+
+    return Index < m_Slot.size () && m_Slot [Index] < m_Ball.size () && m_Ball [m_Slot [Index]] == Ball;
+
+}// IsAlive ()
+
+// Return the slot of a ball, the handle must be alive.
+unsigned CWorld::GetSlot (unsigned Ball) const
+{
+    return m_Slot [Ball & WORLD_INDEX_MASK];
+
+}// GetSlot ()
+
+// Advance every active ball of TimeStep seconds.
+void CWorld::Step (float TimeStep)
+{
+    m_TotalTime += TimeStep;
+
+    // The sleeping balls are stored after the active ones, they are not even read.
+    unsigned ChunkNumber = (m_ActiveCount + WORLD_CHUNK_SIZE - 1) / WORLD_CHUNK_SIZE;
+    if (m_Jobs != 0 && ChunkNumber > 1)
+    {
+        // A chunk only writes to its own balls, and covers whole words of m_Resting. The balls stopped by each chunk
+        // are kept apart, then added in the order of the chunks : the slots stay sorted.
+        m_ChunkStopped.resize (ChunkNumber);
+        m_Jobs->ParallelFor (0, ChunkNumber, 1, [this, TimeStep] (unsigned FirstChunk, unsigned LastChunk)
+        {
+            for (unsigned Chunk = FirstChunk; Chunk < LastChunk; ++Chunk)
+            {
+                m_ChunkStopped [Chunk].clear ();
+                StepChunk (Chunk * WORLD_CHUNK_SIZE, TimeStep, m_ChunkStopped [Chunk]);
+            }
+        });
+
+        for (unsigned Chunk = 0; Chunk < ChunkNumber; ++Chunk)
+            m_Stopped.insert (m_Stopped.end (), m_ChunkStopped [Chunk].begin (), m_ChunkStopped [Chunk].end ());
+    }
+    else
+        for (unsigned First = 0; First < m_ActiveCount; First += WORLD_CHUNK_SIZE)
+            StepChunk (First, TimeStep, m_Stopped);
+
+    // The flights do not go through the segments, the sides they end on are kept for the moves of the collisions and the links.
+    // A sleeping ball keeps the side of its last flight.
+    if (m_Segments != 0)
+    {
+        m_FromX.resize (m_Slot.size ());
+        m_FromY.resize (m_Slot.size ());
+        for (unsigned Slot = 0; Slot < m_ActiveCount; ++Slot)
+        {
+            unsigned Index = m_Ball [Slot] & WORLD_INDEX_MASK;
+            m_FromX [Index] = m_PosX [Slot];
+            m_FromY [Index] = m_PosY [Slot];
+        }
+    }
+
+    // With the contact solver, a stopped ball held by other ones only sleeps with its island.
+    if (m_Radius > 0 && m_SolveContacts)
+        ContactSolving (TimeStep);
+    else
+    {
+        PutToSleep ();
+
+        if (m_Radius > 0)
+            CollisionSolving ();
+
+        // The balls pushed into a segment or the terrain by the other ones go back in front of it.
+        if (m_Radius > 0 && (m_Segments != 0 || m_Terrain != 0))
+            for (unsigned Slot = 0; Slot < m_ActiveCount; ++Slot)
+            {
+                pair <float, float> Velocity = GetVelocity (m_Ball [Slot]);
+                if (SurfaceSolving (Slot, Velocity.first, Velocity.second))
+                    Restart (Slot, Velocity.first, Velocity.second);
+            }
+    }
+
+    // The links pull back the balls moved by the bounces and the collisions.
+    if (m_Links.GetLinkCount () > 0)
+        LinkSolving (TimeStep);
+
+}// Step ()
+
+// Advance the active balls of the chunk starting at the slot First.
+void CWorld::StepChunk (unsigned First, float TimeStep, vector <unsigned> &Stopped)
+{
+    // The balls are processed by chunks that stay in the L1 cache.
+    alignas (64) float NewX [WORLD_CHUNK_SIZE];
+    alignas (64) float NewY [WORLD_CHUNK_SIZE];
+    alignas (64) unsigned Codes [WORLD_CHUNK_SIZE];
+    alignas (64) float AccelX [WORLD_CHUNK_SIZE];
+    alignas (64) float AccelY [WORLD_CHUNK_SIZE];
+
+    unsigned Count = min (WORLD_CHUNK_SIZE, m_ActiveCount - First);
+
+    // The field changes the velocities at the beginning of the step (semi-implicit Euler), the gravity keeps its closed form during it.
+    if (m_Field != 0)
+    {
+        m_Field->Sample (&m_PosX [First], &m_PosY [First], AccelX, AccelY, Count);
+
+        for (unsigned i = 0; i < Count; ++i)
+        {
+            // A ball lying on the floor only leaves it if the field pulls it up more than the gravity holds it.
+            unsigned Slot = First + i;
+            float KickY = m_Resting [Slot] && AccelY [i] <= m_BallGravity [Slot] ? 0 : AccelY [i] * TimeStep;
+            Restart (Slot, m_VelX [Slot] + AccelX [i] * TimeStep, m_VelY [Slot] - m_Gravity [Slot] * m_Time [Slot] + KickY);
+        }
+    }
+
+    // Add time.
+    float *Time = &m_Time [First];
+    for (unsigned i = 0; i < Count; ++i)
+        Time [i] += TimeStep;
+
+    // Compute the points at t = t + TimeStep and detect the collisions.
+    BatchPositionComputing (&m_OriginX [First], &m_OriginY [First], &m_VelX [First], &m_VelY [First],
+                            &m_Gravity [First], Time, NewX, NewY, Count);
+    BatchCollisionDetection (NewX, NewY, Codes, Count);
+
+    // The bounce is computed out of the loop body.
+    for (unsigned i = 0; i < Count; ++i)
+    {
+        // The ball stops on the first segment or piece of terrain touched during the step, the walls are checked at the next one.
+        unsigned Slot = First + i;
+        float StepVelY = m_VelY [Slot] - m_Gravity [Slot] * (Time [i] - TimeStep);
+        CSegmentTree::Impact Impact;
+        bool OnSegment = m_Segments != 0 && m_Segments->FirstImpact (m_PosX [Slot], m_PosY [Slot], m_VelX [Slot], StepVelY, m_Gravity [Slot],
+                                                                     m_Radius, TimeStep, Impact);
+        double TerrainTime;
+        float NX;
+        float NY;
+        if (m_Terrain != 0 && m_Terrain->FirstImpact (m_PosX [Slot], m_PosY [Slot], m_VelX [Slot], StepVelY, m_Gravity [Slot],
+                                                      OnSegment ? Impact.Time : TimeStep, TerrainTime, NX, NY))
+        {
+            if (SurfaceBounce (Slot, TerrainTime, NX, NY, -1, TimeStep))
+                Stopped.push_back (Slot);
+        }
+        else if (OnSegment)
+        {
+            if (SurfaceBounce (Slot, Impact.Time, Impact.NX, Impact.NY, Impact.RestitutionCoef, TimeStep))
+                Stopped.push_back (Slot);
+        }
+        else if (Codes [i] != 0)
+        {
+            if (Bounce (Slot, Codes [i], make_pair (NewX [i], NewY [i]), TimeStep))
+                Stopped.push_back (Slot);
+        }
+        else
+        {
+            m_PosX [Slot] = NewX [i];
+            m_PosY [Slot] = NewY [i];
+
+            // As in CSimulation, the ball sliding on the floor is slowed down by the friction and stops where its speed
+            // reaches 0 instead of going back. It starts again from the end of the step, at the speed left.
+            if (m_Resting [Slot] && m_VelY [Slot] == 0 && m_VelX [Slot] != 0 && m_BallGravity [Slot] > 0)
+            {
+                float Friction = (m_VelX [Slot] > 0 ? 1 : -1) * SLIDE_FRICTION * m_BallGravity [Slot];
+                float Sliding = min (Time [i], m_VelX [Slot] / Friction);
+                m_PosX [Slot] = m_OriginX [Slot] + m_VelX [Slot] * Sliding - 0.5f * Friction * Sliding * Sliding;
+                m_OriginX [Slot] = m_PosX [Slot];
+                m_OriginY [Slot] = m_PosY [Slot];
+                m_VelX [Slot] = Sliding < Time [i] ? 0 : m_VelX [Slot] - Friction * Sliding;
+                Time [i] = 0;
+            }
+
+            // A ball slowed down on the floor by the friction or by the other ones stops between two bounces.
+            if (m_Resting [Slot] && fabs (m_VelX [Slot]) < SLEEP_SPEED)
+            {
+                m_VelX [Slot] = 0;
+                Stopped.push_back (Slot);
+            }
+        }
+    }
+
+}// StepChunk ()
+
+// Put the balls of m_Stopped to sleep, their slots are sorted.
+void CWorld::PutToSleep ()
+{
+    // From the last slot, so that the balls still to move are active ones.
+    while (! m_Stopped.empty ())
+    {
+        --m_ActiveCount;
+        Swap (m_Stopped.back (), m_ActiveCount);
+        m_Stopped.pop_back ();
+    }
+
+}// PutToSleep ()
+
+// Compute the new trajectory of a ball that touched a wall, the floor or the roof.
+bool CWorld::Bounce (unsigned Slot, unsigned Code, pair <float, float> New, float TimeStep)
+{
+    // Velocity at the impact, reflected on the touched surfaces. A ball sliding on the floor was slowed down by the friction.
+    float VelX = m_VelX [Slot];
+    if (m_Resting [Slot] && m_BallGravity [Slot] > 0)
+        VelX = (VelX > 0 ? 1 : -1) * max (0.0f, fabs (VelX) - (float) SLIDE_FRICTION * m_BallGravity [Slot] * m_Time [Slot]);
+    float VelY = ImpactVelocityComputing (m_VelY [Slot] - m_Gravity [Slot] * m_Time [Slot], New.second, m_Gravity [Slot]);
+
+    m_BounceCount [Slot] += ReflectionComputing (VelX, VelY, Code, m_RestitutionCoef [Slot]);
+
+    // A flight shorter than two steps can not be followed (the ball keeps the speed gained during the last step),
+    // the next bounces on the floor are summed and the ball slides without gravity.
+    unsigned Bounces;
+    if ((Code & COLLISION_BOTTOM) && RestComputing (VelY, m_Gravity [Slot], m_RestitutionCoef [Slot], max (REST_FLIGHT_TIME, 2.0 * TimeStep), Bounces) >= 0)
+    {
+        m_BounceCount [Slot] += Bounces;
+        m_Resting [Slot] = true;
+        m_Gravity [Slot] = 0;
+        VelY = 0;
+    }
+
+    // The new trajectory starts from the touched surfaces.
+    New = ClampComputing (New);
+
+    // In the corner of a wall and the terrain, the clamped ball is put back over the terrain.
+    if (m_Terrain != 0)
+        New.second = max (New.second, m_Terrain->GetHeight (New.first) + (float) SURFACE_SKIN);
+
+    // The ball slides too slowly to be seen moving, it is stopped.
+    bool Stopped = m_Resting [Slot] && fabs (VelX) < SLEEP_SPEED;
+    if (Stopped)
+        VelX = 0;
+
+    m_VelX [Slot] = VelX;
+    m_VelY [Slot] = VelY;
+    m_OriginX [Slot] = New.first;
+    m_OriginY [Slot] = New.second;
+    m_Time [Slot] = 0;
+
+    m_PosX [Slot] = New.first;
+    m_PosY [Slot] = New.second;
+
+    return Stopped;
+
+}// Bounce ()
+
+// Exchange the balls stored at two slots.
+void CWorld::Swap (unsigned SlotA, unsigned SlotB)
+{
+    if (SlotA == SlotB)
+        return;
+
+    swap (m_PosX [SlotA], m_PosX [SlotB]);
+    swap (m_PosY [SlotA], m_PosY [SlotB]);
+    swap (m_VelX [SlotA], m_VelX [SlotB]);
+    swap (m_VelY [SlotA], m_VelY [SlotB]);
+    swap (m_OriginX [SlotA], m_OriginX [SlotB]);
+    swap (m_OriginY [SlotA], m_OriginY [SlotB]);
+    swap (m_Time [SlotA], m_Time [SlotB]);
+    swap (m_Gravity [SlotA], m_Gravity [SlotB]);
+    swap (m_BallGravity [SlotA], m_BallGravity [SlotB]);
+    swap (m_RestitutionCoef [SlotA], m_RestitutionCoef [SlotB]);
+    swap (m_BounceCount [SlotA], m_BounceCount [SlotB]);
+
+    bool Resting = m_Resting [SlotA];
+    m_Resting [SlotA] = m_Resting [SlotB];
+    m_Resting [SlotB] = Resting;
+    swap (m_StillTime [SlotA], m_StillTime [SlotB]);
+
+    swap (m_Ball [SlotA], m_Ball [SlotB]);
+    m_Slot [m_Ball [SlotA] & WORLD_INDEX_MASK] = SlotA;
+    m_Slot [m_Ball [SlotB] & WORLD_INDEX_MASK] = SlotB;
+
+}// Swap ()
+
+// Compute the new trajectory of a ball that touched a surface of normal (NX, NY) Time seconds after the beginning of the step.
+bool CWorld::SurfaceBounce (unsigned Slot, float Time, float NX, float NY, float RestitutionCoef, float TimeStep)
+{
+    // Position and velocity at the impact, from the beginning of the step.
+    float Gravity = m_Gravity [Slot];
+    float VelX = m_VelX [Slot];
+    float VelY = m_VelY [Slot] - Gravity * (m_Time [Slot] - TimeStep);
+    float X = m_PosX [Slot] + VelX * Time + (float) SURFACE_SKIN * NX;
+    float Y = m_PosY [Slot] + VelY * Time - 0.5f * Gravity * Time * Time + (float) SURFACE_SKIN * NY;
+    VelY -= Gravity * Time;
+
+    // Reflect the velocity on the touched side, too short a flight off the surface makes the ball slide along it.
+    if (RestitutionCoef < 0)
+        RestitutionCoef = m_RestitutionCoef [Slot];
+    bool Bounced = SurfaceReflectionComputing (VelX, VelY, NX, NY, RestitutionCoef, Gravity, max (REST_FLIGHT_TIME, 2.0 * TimeStep));
+    if (Bounced)
+        ++m_BounceCount [Slot];
+
+    // The ball slides too slowly on the surface to be seen moving, it is stopped.
+    bool Stopped = ! Bounced && VelX * VelX + VelY * VelY < SLEEP_SPEED * SLEEP_SPEED;
+    if (Stopped)
+    {
+        VelX = 0;
+        VelY = 0;
+    }
+
+    // The new trajectory starts in front of the surface, the gravity pulls the ball again.
+    pair <float, float> New = ClampComputing (make_pair (X, Y));
+    m_PosX [Slot] = New.first;
+    m_PosY [Slot] = New.second;
+    m_OriginX [Slot] = New.first;
+    m_OriginY [Slot] = New.second;
+    m_Time [Slot] = 0;
+    m_VelX [Slot] = VelX;
+    m_VelY [Slot] = VelY;
+    m_Gravity [Slot] = m_BallGravity [Slot];
+    m_Resting [Slot] = false;
+
+    return Stopped;
+
+}// SurfaceBounce ()
+
+// Move a ball out of the segments and the terrain it went into, the part of the velocity going into them is removed.
+bool CWorld::SurfaceSolving (unsigned Slot, float &VelX, float &VelY)
+{
+    bool Moved = false;
+
+    // The center goes back over the terrain.
+    if (m_Terrain != 0 && m_PosY [Slot] < m_Terrain->GetHeight (m_PosX [Slot]))
+    {
+        float NX;
+        float NY;
+        m_Terrain->GetNormal (m_PosX [Slot], NX, NY);
+        m_PosY [Slot] = min (m_Terrain->GetHeight (m_PosX [Slot]) + (float) SURFACE_SKIN, (float) ARENA_HEIGHT);
+
+        float Normal = VelX * NX + VelY * NY;
+        if (Normal < 0)
+        {
+            VelX -= Normal * NX;
+            VelY -= Normal * NY;
+        }
+
+        Moved = true;
+    }
+
+    m_SegmentContacts.clear ();
+    if (m_Segments != 0)
+    {
+        unsigned Index = m_Ball [Slot] & WORLD_INDEX_MASK;
+        m_Segments->FindContacts (m_FromX [Index], m_FromY [Index], m_PosX [Slot], m_PosY [Slot], m_Radius, m_SegmentContacts);
+    }
+
+    for (unsigned i = 0; i < m_SegmentContacts.size (); ++i)
+    {
+        const CSegmentTree::Contact &Current = m_SegmentContacts [i];
+
+        // Back to the side where the center was at the end of the flight, even if it was pushed through the segment.
+        float Push = m_Radius + (float) SURFACE_SKIN - Current.Distance;
+        pair <float, float> New = ClampComputing (make_pair (m_PosX [Slot] + Push * Current.NX, m_PosY [Slot] + Push * Current.NY));
+        m_PosX [Slot] = New.first;
+        m_PosY [Slot] = New.second;
+
+        float Normal = VelX * Current.NX + VelY * Current.NY;
+        if (Normal < 0)
+        {
+            VelX -= Normal * Current.NX;
+            VelY -= Normal * Current.NY;
+        }
+    }
+
+    return Moved || ! m_SegmentContacts.empty ();
+
+}// SurfaceSolving ()
+
+// Start a new trajectory of a ball from its position, with the gravity of the ball.
+void CWorld::Restart (unsigned Slot, float VelX, float VelY)
+{
+    m_OriginX [Slot] = m_PosX [Slot];
+    m_OriginY [Slot] = m_PosY [Slot];
+    m_Time [Slot] = 0;
+    m_VelX [Slot] = VelX;
+
+    // A ball lying on the floor stays on it, unless it is thrown upward.
+    if (m_Resting [Slot] && m_PosY [Slot] <= 0 && VelY <= 0)
+    {
+        m_VelY [Slot] = 0;
+        return;
+    }
+
+    m_VelY [Slot] = VelY;
+    m_Gravity [Slot] = m_BallGravity [Slot];
+    m_Resting [Slot] = false;
+
+}// Restart ()
+
+// Find the balls in contact and make them bounce on each other.
+void CWorld::CollisionSolving ()
+{
+    unsigned BallNumber = m_PosX.size ();
+
+    // A cell is at least as large as a ball, so the balls in contact are in neighbour cells. The grid does not get more cells than balls.
+    float CellSize = max (2 * m_Radius, (float) sqrt (ARENA_WIDTH * ARENA_HEIGHT / (double) max (BallNumber, 1u)));
+    m_Grid.Build (m_PosX.data (), m_PosY.data (), BallNumber, CellSize, m_Jobs);
+
+    // Only the active balls look for contacts, the sleeping ones do not move.
+    for (unsigned Slot = 0; Slot < m_ActiveCount; ++Slot)
+    {
+        unsigned FirstColumn;
+        unsigned LastColumn;
+        unsigned FirstRow;
+        unsigned LastRow;
+        GetNeighbourCells (Slot, FirstColumn, LastColumn, FirstRow, LastRow);
+
+        for (unsigned j = FirstRow; j <= LastRow; ++j)
+            for (unsigned i = FirstColumn; i <= LastColumn; ++i)
+            {
+                const unsigned *Begin;
+                const unsigned *End;
+                m_Grid.GetCell (i, j, Begin, End);
+
+                // Each pair of active balls is solved once.
+                for (const unsigned *Other = Begin; Other != End; ++Other)
+                    if (*Other > Slot)
+                        Collide (Slot, *Other);
+            }
+    }
+
+    // Wake the touched sleeping balls up, once the slots are not read anymore.
+    for (unsigned i = 0; i < m_Woken.size (); ++i)
+        Wake (m_Woken [i]);
+    m_Woken.clear ();
+
+}// CollisionSolving ()
+
+// Give the cells of the grid around a ball.
+void CWorld::GetNeighbourCells (unsigned Slot, unsigned &FirstColumn, unsigned &LastColumn, unsigned &FirstRow, unsigned &LastRow) const
+{
+    unsigned Column = m_Grid.GetColumn (m_PosX [Slot]);
+    unsigned Row = m_Grid.GetRow (m_PosY [Slot]);
+
+    FirstColumn = Column > 0 ? Column - 1 : 0;
+    LastColumn = min (Column + 1, m_Grid.GetColumns () - 1);
+    FirstRow = Row > 0 ? Row - 1 : 0;
+    LastRow = min (Row + 1, m_Grid.GetRows () - 1);
+
+}// GetNeighbourCells ()
+
+// Make two balls in contact bounce on each other.
+void CWorld::Collide (unsigned SlotA, unsigned SlotB)
+{
+    float DX = m_PosX [SlotB] - m_PosX [SlotA];
+    float DY = m_PosY [SlotB] - m_PosY [SlotA];
+    float Square = DX * DX + DY * DY;
+    float Diameter = 2 * m_Radius;
+
+    if (Square >= Diameter * Diameter)
+        return;
+
+    // Normal of the contact, any one if the centers are the same.
+    float Distance = sqrt (Square);
+    float NX = 1;
+    float NY = 0;
+    if (Distance > 0)
+    {
+        NX = DX / Distance;
+        NY = DY / Distance;
+    }
+
+    // Move the balls apart, half the overlap each.
+    float Overlap = 0.5f * (Diameter - Distance);
+    pair <float, float> A = ClampComputing (make_pair (m_PosX [SlotA] - NX * Overlap, m_PosY [SlotA] - NY * Overlap));
+    pair <float, float> B = ClampComputing (make_pair (m_PosX [SlotB] + NX * Overlap, m_PosY [SlotB] + NY * Overlap));
+    m_PosX [SlotA] = A.first;
+    m_PosY [SlotA] = A.second;
+    m_PosX [SlotB] = B.first;
+    m_PosY [SlotB] = B.second;
+
+    pair <float, float> VelA = GetVelocity (m_Ball [SlotA]);
+    pair <float, float> VelB = GetVelocity (m_Ball [SlotB]);
+
+    // Same mass for every ball : the normal components are exchanged, scaled by the smallest coefficient.
+    float Approach = (VelB.first - VelA.first) * NX + (VelB.second - VelA.second) * NY;
+    if (Approach < 0)
+    {
+        float Impulse = -0.5f * (1 + min (m_RestitutionCoef [SlotA], m_RestitutionCoef [SlotB])) * Approach;
+
+        VelA.first -= Impulse * NX;
+        VelA.second -= Impulse * NY;
+        VelB.first += Impulse * NX;
+        VelB.second += Impulse * NY;
+        ++m_CollisionCount;
+    }
+
+    // Both balls start a new trajectory from their new position.
+    Restart (SlotA, VelA.first, VelA.second);
+    Restart (SlotB, VelB.first, VelB.second);
+
+    if (SlotB >= m_ActiveCount)
+        m_Woken.push_back (m_Ball [SlotB]);
+
+}// Collide ()
+
+// Find the balls in contact and solve all the contacts together.
+void CWorld::ContactSolving (float TimeStep)
+{
+    unsigned BallNumber = m_PosX.size ();
+    float Diameter = 2 * m_Radius;
+
+    // Same flights as on the floor : a contact bounces only if the rebound lasts long enough to be followed.
+    float MinFlightTime = max (REST_FLIGHT_TIME, 2.0 * TimeStep);
+
+    // The balls of a pile are packed, the grid gets up to 16 cells per ball so that a cell holds a few of them.
+    float CellSize = max (Diameter, (float) sqrt (ARENA_WIDTH * ARENA_HEIGHT / (16.0 * max (BallNumber, 1u))));
+    m_Grid.Build (m_PosX.data (), m_PosY.data (), BallNumber, CellSize, m_Jobs);
+
+    // The solver works on the current velocities of the active balls.
+    m_SolveVelX.resize (m_ActiveCount);
+    m_SolveVelY.resize (m_ActiveCount);
+    for (unsigned Slot = 0; Slot < m_ActiveCount; ++Slot)
+    {
+        m_SolveVelX [Slot] = m_VelX [Slot];
+        m_SolveVelY [Slot] = m_VelY [Slot] - m_Gravity [Slot] * m_Time [Slot];
+
+        // A ball lying on the floor is not pulled down anymore, its weight is given back for the friction.
+        if (m_Resting [Slot])
+            m_SolveVelY [Slot] -= m_BallGravity [Slot] * TimeStep;
+    }
+
+    m_Marked.assign (BallNumber, false);
+    m_Solver.Begin (m_ActiveCount);
+
+    // Surfaces of the arena and their normals going out of it.
+    const unsigned Codes [4] = {COLLISION_LEFT, COLLISION_RIGHT, COLLISION_BOTTOM, COLLISION_TOP};
+    const float Normals [4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+
+    /* CONTACTS, the sleeping balls do not move */
+    for (unsigned Slot = 0; Slot < m_ActiveCount; ++Slot)
+    {
+        // The walls, the floor and the roof hold the balls pushed against them. As for the segments, a ball a little away
+        // from them still touches them : the contact, its impulses and its friction last while the ball stays there.
+        float Skin = 2 * (float) SURFACE_SKIN;
+        const bool Touched [4] = {m_PosX [Slot] <= Skin, m_PosX [Slot] >= ARENA_WIDTH - Skin, m_PosY [Slot] <= Skin, m_PosY [Slot] >= ARENA_HEIGHT - Skin};
+        for (unsigned k = 0; k < 4; ++k)
+            if (Touched [k])
+                m_Solver.AddContact (Slot, CONTACT_ARENA, 0, Normals [k][0], Normals [k][1], ((unsigned long long) m_Ball [Slot] << 32) | (CONTACT_ARENA - Codes [k]), 0);
+
+        // So does the terrain, in place of the floor.
+        if (m_Terrain != 0 && ! Touched [2] && m_PosY [Slot] <= m_Terrain->GetHeight (m_PosX [Slot]) + 2 * (float) SURFACE_SKIN)
+        {
+            float NX;
+            float NY;
+            m_Terrain->GetNormal (m_PosX [Slot], NX, NY);
+            m_Solver.AddContact (Slot, CONTACT_ARENA, 0, -NX, -NY, ((unsigned long long) m_Ball [Slot] << 32) | (CONTACT_ARENA - COLLISION_BOTTOM), 0);
+        }
+
+        // So do the segments, the balls lying on them are a little farther than their radius. Their keys follow the ones of the arena.
+        if (m_Segments != 0)
+        {
+            m_SegmentContacts.clear ();
+            m_Segments->FindContacts (m_PosX [Slot], m_PosY [Slot], m_Radius + 2 * (float) SURFACE_SKIN, m_SegmentContacts);
+
+            for (unsigned k = 0; k < m_SegmentContacts.size (); ++k)
+                m_Solver.AddContact (Slot, CONTACT_ARENA, 0, -m_SegmentContacts [k].NX, -m_SegmentContacts [k].NY,
+                                     ((unsigned long long) m_Ball [Slot] << 32) | (CONTACT_ARENA - COLLISION_TOP - 1 - m_SegmentContacts [k].Segment), 0);
+        }
+
+        unsigned FirstColumn;
+        unsigned LastColumn;
+        unsigned FirstRow;
+        unsigned LastRow;
+        GetNeighbourCells (Slot, FirstColumn, LastColumn, FirstRow, LastRow);
+
+        for (unsigned j = FirstRow; j <= LastRow; ++j)
+            for (unsigned i = FirstColumn; i <= LastColumn; ++i)
+            {
+                const unsigned *Begin;
+                const unsigned *End;
+                m_Grid.GetCell (i, j, Begin, End);
+
+                for (const unsigned *Other = Begin; Other != End; ++Other)
+                {
+                    // Each pair of active balls once, each pair of an active and a sleeping ball from the active one.
+                    bool Asleep = *Other >= m_ActiveCount;
+                    if (! Asleep && *Other <= Slot)
+                        continue;
+
+                    float DX = m_PosX [*Other] - m_PosX [Slot];
+                    float DY = m_PosY [*Other] - m_PosY [Slot];
+                    float Square = DX * DX + DY * DY;
+
+                    if (Square >= Diameter * Diameter)
+                        continue;
+
+                    float Distance = sqrt (Square);
+                    float NX = 1;
+                    float NY = 0;
+                    if (Distance > 0)
+                    {
+                        NX = DX / Distance;
+                        NY = DY / Distance;
+                    }
+
+                    float Approach = ((Asleep ? 0 : m_SolveVelX [*Other]) - m_SolveVelX [Slot]) * NX
+                                   + ((Asleep ? 0 : m_SolveVelY [*Other]) - m_SolveVelY [Slot]) * NY;
+
+                    // Only the fast contacts bounce, the others stop the balls against each other.
+                    float TargetSpeed = 0;
+                    float RestitutionCoef = min (m_RestitutionCoef [Slot], m_RestitutionCoef [*Other]);
+                    float Gravity = max (m_BallGravity [Slot], m_BallGravity [*Other]);
+                    if (Approach < 0 && RestitutionCoef > 0 && (Gravity <= 0 || -2 * RestitutionCoef * Approach / Gravity > MinFlightTime))
+                    {
+                        TargetSpeed = -RestitutionCoef * Approach;
+                        ++m_CollisionCount;
+                    }
+
+                    // A ball falling on a sleeping pile wakes it up at the end of the step.
+                    if (Asleep && ! m_Marked [*Other] && -Approach > max ((float) SLEEP_SPEED, Gravity * MinFlightTime))
+                    {
+                        m_Marked [*Other] = true;
+                        m_Woken.push_back (m_Ball [*Other]);
+                    }
+
+                    unsigned First = min (m_Ball [Slot], m_Ball [*Other]);
+                    unsigned Second = max (m_Ball [Slot], m_Ball [*Other]);
+                    m_Solver.AddContact (Slot, *Other, Asleep ? 0 : 1, NX, NY, ((unsigned long long) First << 32) | Second, TargetSpeed);
+                }
+            }
+    }
+
+    m_Solver.Solve (m_PosX.data (), m_PosY.data (), m_SolveVelX.data (), m_SolveVelY.data (), m_Radius);
+
+    // The balls pushed into a segment or the terrain by the other ones go back in front of it.
+    if (m_Segments != 0 || m_Terrain != 0)
+        for (unsigned Slot = 0; Slot < m_ActiveCount; ++Slot)
+            SurfaceSolving (Slot, m_SolveVelX [Slot], m_SolveVelY [Slot]);
+
+    /* NEW TRAJECTORIES, an island of balls still long enough falls asleep */
+    vector <unsigned> Sleeping;
+    for (unsigned Island = 0; Island < m_Solver.GetIslandCount (); ++Island)
+    {
+        const unsigned *Begin;
+        const unsigned *End;
+        m_Solver.GetIsland (Island, Begin, End);
+
+        float StillTime = SLEEP_DELAY;
+        for (const unsigned *Slot = Begin; Slot != End; ++Slot)
+        {
+            // As after a bounce, a ball pushed up from the floor for a flight too short to be followed stays on it.
+            if (m_PosY [*Slot] <= 0 && 2 * m_SolveVelY [*Slot] < m_BallGravity [*Slot] * MinFlightTime)
+            {
+                m_Resting [*Slot] = true;
+                m_Gravity [*Slot] = 0;
+                m_SolveVelY [*Slot] = 0;
+            }
+
+            Restart (*Slot, m_SolveVelX [*Slot], m_SolveVelY [*Slot]);
+            m_Marked [*Slot] = true;
+
+            pair <float, float> Velocity = GetVelocity (m_Ball [*Slot]);
+            if (Velocity.first * Velocity.first + Velocity.second * Velocity.second < SLEEP_SPEED * SLEEP_SPEED)
+                m_StillTime [*Slot] += TimeStep;
+            else
+                m_StillTime [*Slot] = 0;
+
+            StillTime = min (StillTime, m_StillTime [*Slot]);
+        }
+
+        if (StillTime >= SLEEP_DELAY)
+            Sleeping.push_back (Island);
+    }
+
+    // The balls stopped by the step alone fall asleep at once, the others with their island.
+    unsigned Kept = 0;
+    for (unsigned i = 0; i < m_Stopped.size (); ++i)
+        if (! m_Marked [m_Stopped [i]])
+            m_Stopped [Kept++] = m_Stopped [i];
+    m_Stopped.resize (Kept);
+
+    for (unsigned i = 0; i < Sleeping.size (); ++i)
+    {
+        const unsigned *Begin;
+        const unsigned *End;
+        m_Solver.GetIsland (Sleeping [i], Begin, End);
+
+        for (const unsigned *Slot = Begin; Slot != End; ++Slot)
+        {
+            Restart (*Slot, 0, 0);
+            m_Stopped.push_back (*Slot);
+        }
+    }
+
+    // The whole pile around a woken ball wakes up, the balls it holds would float otherwise.
+    for (unsigned k = 0; k < m_Woken.size (); ++k)
+    {
+        unsigned Slot = GetSlot (m_Woken [k]);
+
+        unsigned FirstColumn;
+        unsigned LastColumn;
+        unsigned FirstRow;
+        unsigned LastRow;
+        GetNeighbourCells (Slot, FirstColumn, LastColumn, FirstRow, LastRow);
+
+        for (unsigned j = FirstRow; j <= LastRow; ++j)
+            for (unsigned i = FirstColumn; i <= LastColumn; ++i)
+            {
+                const unsigned *Begin;
+                const unsigned *End;
+                m_Grid.GetCell (i, j, Begin, End);
+
+                for (const unsigned *Other = Begin; Other != End; ++Other)
+                {
+                    if (*Other < m_ActiveCount || m_Marked [*Other])
+                        continue;
+
+                    float DX = m_PosX [*Other] - m_PosX [Slot];
+                    float DY = m_PosY [*Other] - m_PosY [Slot];
+                    if (DX * DX + DY * DY < WakeDistance * WakeDistance * Diameter * Diameter)
+                    {
+                        m_Marked [*Other] = true;
+                        m_Woken.push_back (m_Ball [*Other]);
+                    }
+                }
+            }
+    }
+
+    // The slots change from here.
+    sort (m_Stopped.begin (), m_Stopped.end ());
+    PutToSleep ();
+
+    for (unsigned k = 0; k < m_Woken.size (); ++k)
+        Wake (m_Woken [k]);
+    m_Woken.clear ();
+
+}// ContactSolving ()
+
+// Keep the linked balls at the lengths of their links.
+void CWorld::LinkSolving (float TimeStep)
+{
+    /* WAKING, a sleeping ball linked to a moving one wakes up, the chain wakes up ball after ball */
+    for (unsigned i = 0; i < m_Links.GetLinkCount (); ++i)
+    {
+        unsigned A;
+        unsigned B;
+        m_Links.GetLink (i, A, B);
+        if (B == LINK_ANCHOR)
+            continue;
+
+        bool AsleepA = m_Slot [A] >= m_ActiveCount;
+        bool AsleepB = m_Slot [B] >= m_ActiveCount;
+        if (AsleepA != AsleepB)
+            Wake (m_Ball [m_Slot [AsleepA ? A : B]]);
+    }
+
+    // The solver works on the current velocities of the active balls.
+    m_SolveVelX.resize (m_ActiveCount);
+    m_SolveVelY.resize (m_ActiveCount);
+    for (unsigned Slot = 0; Slot < m_ActiveCount; ++Slot)
+    {
+        m_SolveVelX [Slot] = m_VelX [Slot];
+        m_SolveVelY [Slot] = m_VelY [Slot] - m_Gravity [Slot] * m_Time [Slot];
+    }
+
+    m_Links.Solve (m_Slot.data (), m_ActiveCount, m_PosX.data (), m_PosY.data (), m_SolveVelX.data (), m_SolveVelY.data (), TimeStep);
+
+    /* NEW TRAJECTORIES, once for each active linked ball */
+    m_Marked.assign (m_PosX.size (), false);
+    for (unsigned i = 0; i < m_Links.GetLinkCount (); ++i)
+    {
+        unsigned Bodies [2];
+        m_Links.GetLink (i, Bodies [0], Bodies [1]);
+
+        for (unsigned k = 0; k < 2; ++k)
+        {
+            if (Bodies [k] == LINK_ANCHOR)
+                continue;
+
+            unsigned Slot = m_Slot [Bodies [k]];
+            if (Slot >= m_ActiveCount || m_Marked [Slot])
+                continue;
+
+            m_Marked [Slot] = true;
+
+            // The links may pull a ball into a segment or the terrain.
+            if (m_Segments != 0 || m_Terrain != 0)
+                SurfaceSolving (Slot, m_SolveVelX [Slot], m_SolveVelY [Slot]);
+
+            Restart (Slot, m_SolveVelX [Slot], m_SolveVelY [Slot]);
+        }
+    }
+
+}// LinkSolving ()
+
+// Wake a sleeping ball up, it starts again from its position with its velocity.
+bool CWorld::Wake (unsigned Ball)
+{
+    if (! IsAlive (Ball))
+        return false;
+
+    unsigned Slot = GetSlot (Ball);
+
+    // The new trajectory starts from the current position.
+    pair <float, float> Velocity = GetVelocity (Ball);
+    Restart (Slot, Velocity.first, Velocity.second);
+    m_StillTime [Slot] = 0;
+
+    // Move it with the active balls.
+    if (Slot >= m_ActiveCount)
+    {
+        Swap (Slot, m_ActiveCount);
+        ++m_ActiveCount;
+    }
+
+    return true;
+
+}// Wake ()
+
+// Change the velocity of a ball and wake it up.
+bool CWorld::SetVelocity (unsigned Ball, float VelX, float VelY)
+{
+    if (! Wake (Ball))
+        return false;
+
+    Restart (GetSlot (Ball), VelX, VelY);
+
+    return true;
+
+}// SetVelocity ()
+
+// Change the gravity of a ball and wake it up.
+bool CWorld::SetGravity (unsigned Ball, float Gravity)
+{
+    if (! IsAlive (Ball))
+        return false;
+
+    m_BallGravity [GetSlot (Ball)] = Gravity;
+
+    return Wake (Ball);
+
+}// SetGravity ()
+
+// Change the coefficient of restitution of a ball and wake it up.
+bool CWorld::SetRestitutionCoef (unsigned Ball, float RestitutionCoef)
+{
+    if (! Wake (Ball))
+        return false;
+
+    m_RestitutionCoef [GetSlot (Ball)] = RestitutionCoef;
+
+    return true;
+
+}// SetRestitutionCoef ()
+
+// Set the number of passes of the contact solver, 0 for the bounces of each pair of balls one after the other.
+void CWorld::SetSolverIterations (unsigned Iterations)
+{
+    m_SolveContacts = Iterations > 0;
+    m_Solver.SetIterations (Iterations);
+
+}// SetSolverIterations ()
+
+// Set the maximum number of threads of the contact and link solvers, 0 for one per core.
+void CWorld::SetThreadCount (unsigned ThreadCount)
+{
+    m_Solver.SetThreadCount (ThreadCount);
+    m_Links.SetThreadCount (ThreadCount);
+
+}// SetThreadCount ()
+
+// Link two balls at their current distance.
+unsigned CWorld::AddLink (unsigned BallA, unsigned BallB, float Stiffness/* = 0*/)
+{
+    if (! IsAlive (BallA) || ! IsAlive (BallB))
+        return WORLD_NO_LINK;
+
+    pair <float, float> A = GetPosition (BallA);
+    pair <float, float> B = GetPosition (BallB);
+    float Length = sqrt ((B.first - A.first) * (B.first - A.first) + (B.second - A.second) * (B.second - A.second));
+
+    return m_Links.AddLink (BallA & WORLD_INDEX_MASK, BallB & WORLD_INDEX_MASK, Length, Stiffness);
+
+}// AddLink ()
+
+// Link a ball to the fixed point (X, Y) at their current distance.
+unsigned CWorld::AddAnchor (unsigned Ball, float X, float Y, float Stiffness/* = 0*/)
+{
+    if (! IsAlive (Ball))
+        return WORLD_NO_LINK;
+
+    pair <float, float> A = GetPosition (Ball);
+    float Length = sqrt ((X - A.first) * (X - A.first) + (Y - A.second) * (Y - A.second));
+
+    return m_Links.AddAnchor (Ball & WORLD_INDEX_MASK, X, Y, Length, Stiffness);
+
+}// AddAnchor ()
+
+// Set the number of passes of the link solver.
+void CWorld::SetLinkIterations (unsigned Iterations)
+{
+    m_Links.SetIterations (Iterations);
+
+}// SetLinkIterations ()
+
+// Set the static segments the balls bounce on, 0 for none.
+void CWorld::SetSegments (const CSegmentTree *Segments)
+{
+    m_Segments = Segments;
+
+}// SetSegments ()
+
+// Set the uneven floor the balls bounce on, 0 for the flat one.
+void CWorld::SetTerrain (const CTerrain *Terrain)
+{
+    m_Terrain = Terrain;
+
+}// SetTerrain ()
+
+// Set the force field added to the gravity of the balls, 0 for none.
+void CWorld::SetForceField (const CForceField *Field)
+{
+    m_Field = Field;
+
+}// SetForceField ()
+
+// Set the job system running the chunks of balls, the building of the grid, the islands of contacts and the colours of links.
+void CWorld::SetJobSystem (CJobSystem *Jobs)
+{
+    m_Jobs = Jobs;
+    m_Solver.SetJobSystem (Jobs);
+    m_Links.SetJobSystem (Jobs);
+
+}// SetJobSystem ()
+
+// Return the number of balls.
+unsigned CWorld::GetBallCount () const
+{
+    return m_PosX.size ();
+
+}// GetBallCount ()
+
+// Set the radius of the balls, 0 for points that do not collide with each other.
+void CWorld::SetRadius (float Radius)
+{
+    m_Radius = Radius;
+
+}// SetRadius ()
+
+// Return the radius of the balls.
+float CWorld::GetRadius () const
+{
+    return m_Radius;
+
+}// GetRadius ()
+
+// Return the number of collisions between balls since the beginning.
+unsigned long CWorld::GetCollisionCount () const
+{
+    return m_CollisionCount;
+
+}// GetCollisionCount ()
+
+// Return the number of contacts of the last step of the contact solver.
+unsigned CWorld::GetContactCount () const
+{
+    return m_Solver.GetContactCount ();
+
+}// GetContactCount ()
+
+// Return the number of islands of the last step of the contact solver.
+unsigned CWorld::GetIslandCount () const
+{
+    return m_Solver.GetIslandCount ();
+
+}// GetIslandCount ()
+
+// Return the number of links.
+unsigned CWorld::GetLinkCount () const
+{
+    return m_Links.GetLinkCount ();
+
+}// GetLinkCount ()
+
+// Return the number of colours of the links.
+unsigned CWorld::GetLinkColourCount () const
+{
+    return m_Links.GetColourCount ();
+
+}// GetLinkColourCount ()
+
+// Return the number of balls not asleep.
+unsigned CWorld::GetActiveCount () const
+{
+    return m_ActiveCount;
+
+}// GetActiveCount ()
+
+// Return the time elapsed since the beginning of the simulation.
+float CWorld::GetTotalTime () const
+{
+    return m_TotalTime;
+
+}// GetTotalTime ()
+
+// Return the position of a ball.
+pair <float, float> CWorld::GetPosition (unsigned Ball) const
+{
+    if (! IsAlive (Ball))
+        return make_pair (0.0f, 0.0f);
+
+    unsigned Slot = GetSlot (Ball);
+
+    return make_pair (m_PosX [Slot], m_PosY [Slot]);
+
+}// GetPosition ()
+
+// Return the speed of a ball.
+float CWorld::GetSpeed (unsigned Ball) const
+{
+    pair <float, float> Velocity = GetVelocity (Ball);
+
+    return sqrt (Velocity.first * Velocity.first + Velocity.second * Velocity.second);
+
+}// GetSpeed ()
+
+// Return the velocity of a ball.
+pair <float, float> CWorld::GetVelocity (unsigned Ball) const
+{
+    if (! IsAlive (Ball))
+        return make_pair (0.0f, 0.0f);
+
+    unsigned Slot = GetSlot (Ball);
+
+    return make_pair (m_VelX [Slot], m_VelY [Slot] - m_Gravity [Slot] * m_Time [Slot]);
+
+}// GetVelocity ()
+
+// Return the number of bounces of a ball.
+unsigned CWorld::GetBounceCount (unsigned Ball) const
+{
+    return IsAlive (Ball) ? m_BounceCount [GetSlot (Ball)] : 0;
+
+}// GetBounceCount ()
+
+// Tells if the bounces of a ball on the floor became too small to be followed, the ball slides on it.
+bool CWorld::IsResting (unsigned Ball) const
+{
+    return IsAlive (Ball) && m_Resting [GetSlot (Ball)];
+
+}// IsResting ()
+
+// Tells if a ball stopped and is not stepped anymore.
+bool CWorld::IsSleeping (unsigned Ball) const
+{
+    return IsAlive (Ball) && GetSlot (Ball) >= m_ActiveCount;
+
+}// IsSleeping ()
+
+// Return the X coordinates array.
+const float *CWorld::GetPositionsX () const
+{
+    return m_PosX.data ();
+
+}// GetPositionsX ()
+
+// Return the Y coordinates array.
+const float *CWorld::GetPositionsY () const
+{
+    return m_PosY.data ();
+
+}// GetPositionsY ()
+
+// Return the handle of the ball stored at Slot in the coordinates arrays.
+unsigned CWorld::GetBallAt (unsigned Slot) const
+{
+    return m_Ball [Slot];
+
+}// GetBallAt ()
@@ -0,0 +1,318 @@
+/**
+ *
+ * @file CWorld.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief CWorld header file.
+ *
+ * @details Contain declaration of the class CWorld, the headless multi-ball world.
+ *          The balls are stored in structure-of-arrays form : one contiguous array per variable.
+ *          The direction of a ball is the sign of its velocity.
+ *          The balls that stopped on the floor are asleep : they are stored after the active ones and are not stepped anymore.
+ *          When the balls have a radius they collide with each other, the close balls being found with a uniform grid.
+ *          The contacts can be solved all together instead, so that the piles of balls stay still and fall asleep as a whole.
+ *          A ball is known by a handle : its index and the number of times the index was reused. A removed ball leaves its
+ *          slot to the last ball of the arrays, and its index to the next ball added, so that adding and removing balls
+ *          keeps the arrays dense and does not allocate memory once it is reserved.
+ *          The balls can be linked by rods and springs, to other balls or to fixed points, to make chains, ropes and nets.
+ *          In a force field the trajectories are not parabolas anymore : at the beginning of each step the velocity gets
+ *          the acceleration of the field, then the ball follows the parabola of its gravity during the step.
+ *          With a job system the chunks of balls are stepped and the grid is built on every core. The collisions of the
+ *          pairs of balls stay on the calling thread : their result depends on their order.
+ *
+ * @see CWorld.cpp
+ *
+ **/
+
+#ifndef __CWORLD_H__
+#define __CWORLD_H__
+
+#include <vector>       // std::vector
+#include <utility>      // std::pair
+
+#include "common.h"     // Settings struct
+#include "CGrid.h"      // Uniform grid
+#include "CContactSolver.h" // Contact solver
+#include "CLinkSolver.h"    // Link solver
+#include "CSegmentTree.h"   // Static segments
+#include "CTerrain.h"       // Uneven floor
+#include "CForceField.h"    // Force field
+#include "CJobSystem.h"     // Job system
+
+// Number of balls processed at once by the batched functions.
+#define WORLD_CHUNK_SIZE    1024u
+
+// Number of bits of the index of a ball in its handle, the other bits count the reuses of the index.
+#define WORLD_INDEX_BITS    22u
+#define WORLD_INDEX_MASK    ((1u << WORLD_INDEX_BITS) - 1)
+
+// Largest number of balls of a world (the last index is never used), and handle returned when no ball can be added.
+#define WORLD_MAX_BALLS     WORLD_INDEX_MASK
+#define WORLD_NO_BALL       0xFFFFFFFFu
+
+// Link returned when a handle given to link balls is stale.
+#define WORLD_NO_LINK       0xFFFFFFFFu
+
+/*
+** CWorld class that contains N balls and computes their trajectories, one step after the other.
+*/
+class CWorld
+{
+    public :
+
+        // Initialize an empty world.
+        CWorld ();
+
+        // Reserve memory for BallNumber balls, adding and removing balls does not allocate memory while there are less.
+        void Reserve (unsigned BallNumber);
+
+        // Remove every ball.
+        void Clear ();
+
+        // Add a ball launched with the parameters from the abscissa X, return its handle, WORLD_NO_BALL if no index is left.
+        // The handles of the first balls added are their indexes 0, 1, 2... An index is used by 1024 balls one after the
+        // other, with a new generation each time, then never again : a handle is never given twice, and about 4 billion
+        // balls can be added to a world in its life.
+        unsigned AddBall (const nsTools::Settings &Parameters, float X = 0);
+
+        // Remove a ball, return false if the handle is not the one of a ball of the world anymore.
+        bool RemoveBall (unsigned Ball);
+
+        // Tells if the handle is the one of a ball of the world. Given a stale handle, the other functions do nothing and return
+        // false, 0 or WORLD_NO_LINK.
+        bool IsAlive (unsigned Ball) const;
+
+        // Set the radius of the balls, 0 for points that do not collide with each other.
+        void SetRadius (float Radius);
+
+        // Set the number of passes of the contact solver, 0 for the bounces of each pair of balls one after the other.
+        void SetSolverIterations (unsigned Iterations);
+
+        // Set the maximum number of threads of the contact and link solvers, 0 for one per core.
+        void SetThreadCount (unsigned ThreadCount);
+
+        // Link two balls at their current distance, Stiffness 0 for a rod, else a spring (N/m for a ball of 1 kg).
+        // Return the index of the link, WORLD_NO_LINK if a handle is stale. The links of a removed ball are removed too.
+        unsigned AddLink (unsigned BallA, unsigned BallB, float Stiffness = 0);
+
+        // Link a ball to the fixed point (X, Y) at their current distance. Return the index of the link, WORLD_NO_LINK if the handle is stale.
+        unsigned AddAnchor (unsigned Ball, float X, float Y, float Stiffness = 0);
+
+        // Set the number of passes of the link solver.
+        void SetLinkIterations (unsigned Iterations);
+
+        // Set the static segments the balls bounce on, 0 for none. The segments are not copied.
+        void SetSegments (const CSegmentTree *Segments);
+
+        // Set the uneven floor the balls bounce on, 0 for the flat one. The terrain is not copied.
+        void SetTerrain (const CTerrain *Terrain);
+
+        // Set the force field added to the gravity of the balls, 0 for none. The field is not copied.
+        void SetForceField (const CForceField *Field);
+
+        // Set the job system running the chunks of balls, the building of the grid, the islands of contacts and the colours of links,
+        // 0 to run them on the calling thread.
+        // The job system is not copied.
+        void SetJobSystem (CJobSystem *Jobs);
+
+        // Advance every active ball of TimeStep seconds.
+        void Step (float TimeStep);
+
+        // Wake a sleeping ball up, it starts again from its position with its velocity.
+        bool Wake (unsigned Ball);
+
+        // Change the velocity of a ball and wake it up.
+        bool SetVelocity (unsigned Ball, float VelX, float VelY);
+
+        // Change the gravity of a ball and wake it up.
+        bool SetGravity (unsigned Ball, float Gravity);
+
+        // Change the coefficient of restitution of a ball and wake it up.
+        bool SetRestitutionCoef (unsigned Ball, float RestitutionCoef);
+
+        // Return the number of balls.
+        unsigned GetBallCount () const;
+
+        // Return the number of balls not asleep.
+        unsigned GetActiveCount () const;
+
+        // Return the radius of the balls.
+        float GetRadius () const;
+
+        // Return the number of collisions between balls since the beginning.
+        unsigned long GetCollisionCount () const;
+
+        // Return the number of contacts and islands of the last step of the contact solver.
+        unsigned GetContactCount () const;
+        unsigned GetIslandCount () const;
+
+        // Return the number of links and of their colours, the groups of links solved in parallel.
+        unsigned GetLinkCount () const;
+        unsigned GetLinkColourCount () const;
+
+        // Return the time elapsed since the beginning of the simulation.
+        float GetTotalTime () const;
+
+        // Return the position of a ball.
+        std::pair <float, float> GetPosition (unsigned Ball) const;
+
+        // Return the speed of a ball.
+        float GetSpeed (unsigned Ball) const;
+
+        // Return the velocity of a ball.
+        std::pair <float, float> GetVelocity (unsigned Ball) const;
+
+        // Return the number of bounces of a ball.
+        unsigned GetBounceCount (unsigned Ball) const;
+
+        // Tells if the bounces of a ball on the floor became too small to be followed, the ball slides on it.
+        bool IsResting (unsigned Ball) const;
+
+        // Tells if a ball stopped and is not stepped anymore.
+        bool IsSleeping (unsigned Ball) const;
+
+        // Return the X and Y coordinates arrays, in storage order : the active balls first.
+        const float *GetPositionsX () const;
+        const float *GetPositionsY () const;
+
+        // Return the handle of the ball stored at Slot in the coordinates arrays.
+        unsigned GetBallAt (unsigned Slot) const;
+
+    private :
+
+        // Advance the active balls of the chunk starting at the slot First, the slots of the ones that stopped are added to Stopped.
+        void StepChunk (unsigned First, float TimeStep, std::vector <unsigned> &Stopped);
+
+        // Compute the new trajectory of a ball that touched a wall, the floor or the roof (Code as given by BatchCollisionDetection).
+        // Return true if the ball stopped.
+        bool Bounce (unsigned Slot, unsigned Code, std::pair <float, float> New, float TimeStep);
+
+        // Compute the new trajectory of a ball that touched a surface of normal (NX, NY) Time seconds after the beginning of the step.
+        // RestitutionCoef is the one of the surface, negative to use the one of the ball. Return true if the ball stopped.
+        bool SurfaceBounce (unsigned Slot, float Time, float NX, float NY, float RestitutionCoef, float TimeStep);
+
+        // Move a ball out of the segments and the terrain it went into, the part of the velocity going into them is removed.
+        // The ball goes back on the side of the segments it was on at the end of its flight. Return true if the ball moved.
+        bool SurfaceSolving (unsigned Slot, float &VelX, float &VelY);
+
+        // Put the balls of m_Stopped to sleep, their slots are sorted.
+        void PutToSleep ();
+
+        // Exchange the balls stored at two slots.
+        void Swap (unsigned SlotA, unsigned SlotB);
+
+        // Return the slot of a ball, the handle must be alive.
+        unsigned GetSlot (unsigned Ball) const;
+
+        // Start a new trajectory of a ball from its position, with the gravity of the ball.
+        void Restart (unsigned Slot, float VelX, float VelY);
+
+        // Find the balls in contact and make them bounce on each other.
+        void CollisionSolving ();
+
+        // Make two balls in contact bounce on each other.
+        void Collide (unsigned SlotA, unsigned SlotB);
+
+        // Find the balls in contact and solve all the contacts together.
+        void ContactSolving (float TimeStep);
+
+        // Keep the linked balls at the lengths of their links, a moving ball wakes up the balls linked to it.
+        void LinkSolving (float TimeStep);
+
+        // Give the cells of the grid around a ball.
+        void GetNeighbourCells (unsigned Slot, unsigned &FirstColumn, unsigned &LastColumn, unsigned &FirstRow, unsigned &LastRow) const;
+
+        // Current position of the balls.
+        std::vector <float> m_PosX;
+        std::vector <float> m_PosY;
+
+        // Launch velocity of the current trajectory.
+        std::vector <float> m_VelX;
+        std::vector <float> m_VelY;
+
+        // Launch origin of the current trajectory.
+        std::vector <float> m_OriginX;
+        std::vector <float> m_OriginY;
+
+        // Time elapsed since the beginning of the current trajectory.
+        std::vector <float> m_Time;
+
+        // Gravity of the current trajectory, 0 once the balls slide on the floor.
+        std::vector <float> m_Gravity;
+
+        // Gravity the balls are attracted by.
+        std::vector <float> m_BallGravity;
+
+        // Coefficient of restitution of the balls.
+        std::vector <float> m_RestitutionCoef;
+
+        // Number of bounces of the balls.
+        std::vector <unsigned> m_BounceCount;
+
+        // Tells if the balls slide on the floor.
+        std::vector <bool> m_Resting;
+
+        // Time the balls in contact have been slower than SLEEP_SPEED.
+        std::vector <float> m_StillTime;
+
+        // Slot of each index of ball in the arrays above, and handle of the ball stored at each slot.
+        std::vector <unsigned> m_Slot;
+        std::vector <unsigned> m_Ball;
+
+        // Handles of the removed balls, their indexes are given to the next balls added unless their last generation is used.
+        std::vector <unsigned> m_Removed;
+
+        // Number of active balls, stored in the first slots.
+        unsigned m_ActiveCount;
+
+        // Slots of the balls that stopped during the current step, and the ones of each chunk stepped by the job system.
+        std::vector <unsigned> m_Stopped;
+        std::vector <std::vector <unsigned> > m_ChunkStopped;
+
+        // Balls asleep touched during the current step.
+        std::vector <unsigned> m_Woken;
+
+        // Radius of the balls and grid of their positions.
+        float m_Radius;
+        CGrid m_Grid;
+
+        // Contact solver, its velocities of the active balls, and the balls it met : the sleeping ones to wake up and the active ones of an island.
+        bool m_SolveContacts;
+        CContactSolver m_Solver;
+        std::vector <float> m_SolveVelX;
+        std::vector <float> m_SolveVelY;
+        std::vector <bool> m_Marked;
+
+        // Links between the balls and to fixed points.
+        CLinkSolver m_Links;
+
+        // Static segments the balls bounce on, and the ones touching the current ball.
+        const CSegmentTree *m_Segments;
+        std::vector <CSegmentTree::Contact> m_SegmentContacts;
+
+        // Positions of the balls, by indexes, at the end of their last flights : they give the side of the segments
+        // the balls are on, whatever the moves of the collisions and of the links.
+        std::vector <float> m_FromX;
+        std::vector <float> m_FromY;
+
+        // Uneven floor the balls bounce on.
+        const CTerrain *m_Terrain;
+
+        // Force field added to the gravity.
+        const CForceField *m_Field;
+
+        // Job system running the chunks and the building of the grid.
+        CJobSystem *m_Jobs;
+
+        // Number of collisions between balls since the beginning.
+        unsigned long m_CollisionCount;
+
+        // Time elapsed since the beginning of the simulation.
+        float m_TotalTime;
+};
+#endif // __CWORLD_H__
@@ -0,0 +1,557 @@
+/**
+ *
+ * @file batch.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Batch source file.
+ *
+ * @details Contain definitions of the batched trajectory and collision functions.
+ *          Every kernel is compiled for its own instruction set thanks to the GCC target attribute,
+ *          the whole project keeps its default compiler options. The contraction in FMA is disabled on
+ *          every kernel, the scalar one included, so every instruction set gives exactly the same results
+ *          whatever the options of the build (-march=native enables FMA on the code without target).
+ *
+ * @see batch.h
+ *
+ **/
+
+#include <algorithm>    // std::min, std::max
+
+#include "batch.h"      // Batch
+#include "common.h"     // ARENA_WIDTH, ARENA_HEIGHT
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+    #define BATCH_X86
+    #include <immintrin.h>  // SSE2, AVX2, AVX-512 intrinsics
+#endif
+
+// Every kernel rounds each product and each sum on its own.
+#ifdef __GNUC__
+    #define BATCH_EXACT __attribute__ ((optimize ("fp-contract=off")))
+#else
+    #define BATCH_EXACT
+#endif
+
+using namespace nsTools;
+
+namespace
+{
+    /*
+    ** SCALAR KERNELS, ALSO USED FOR THE LAST BALLS OF THE SIMD KERNELS
+    */
+
+    // Scalar position computing from the ball First to the ball Count.
+    BATCH_EXACT
+    void PositionScalar (const float *OriginX, const float *OriginY, const float *VelX, const float *VelY,
+                         const float *Gravity, const float *Time, float *X, float *Y, unsigned First, unsigned Count)
+    {
+        for (unsigned i = First; i < Count; ++i)
+        {
+            X [i] = OriginX [i] + VelX [i] * Time [i];
+            Y [i] = OriginY [i] + VelY [i] * Time [i] - 0.5f * Gravity [i] * Time [i] * Time [i];
+        }
+    }// PositionScalar ()
+
+    // Scalar collision detection from the ball First to the ball Count.
+    BATCH_EXACT
+    void CollisionScalar (const float *X, const float *Y, unsigned *Codes, unsigned First, unsigned Count)
+    {
+        for (unsigned i = First; i < Count; ++i)
+        {
+            Codes [i] = (unsigned) (X [i] < 0) * COLLISION_LEFT
+                      | (unsigned) (X [i] > ARENA_WIDTH) * COLLISION_RIGHT
+                      | (unsigned) (Y [i] < 0) * COLLISION_BOTTOM
+                      | (unsigned) (Y [i] > ARENA_HEIGHT) * COLLISION_TOP;
+        }
+    }// CollisionScalar ()
+
+    // Scalar bilinear sampling from the point First to the point Count.
+    BATCH_EXACT
+    void SamplingScalar (const float *ValuesX, const float *ValuesY, unsigned Columns, unsigned Rows, float ScaleX, float ScaleY,
+                         const float *X, const float *Y, float *SampleX, float *SampleY, unsigned First, unsigned Count)
+    {
+        float LastX = Columns - 1;
+        float LastY = Rows - 1;
+        float CellX = Columns - 2;
+        float CellY = Rows - 2;
+
+        for (unsigned i = First; i < Count; ++i)
+        {
+            // Coordinates in nodes, the points out of the grid take the value of its border.
+            float GX = std::min (std::max (X [i] * ScaleX, 0.0f), LastX);
+            float GY = std::min (std::max (Y [i] * ScaleY, 0.0f), LastY);
+            float CX = std::min ((float) (int) GX, CellX);
+            float CY = std::min ((float) (int) GY, CellY);
+            float TX = GX - CX;
+            float TY = GY - CY;
+            unsigned Node = (unsigned) (CY * Columns + CX);
+
+            float Bottom = ValuesX [Node] + TX * (ValuesX [Node + 1] - ValuesX [Node]);
+            float Top = ValuesX [Node + Columns] + TX * (ValuesX [Node + Columns + 1] - ValuesX [Node + Columns]);
+            SampleX [i] = Bottom + TY * (Top - Bottom);
+
+            Bottom = ValuesY [Node] + TX * (ValuesY [Node + 1] - ValuesY [Node]);
+            Top = ValuesY [Node + Columns] + TX * (ValuesY [Node + Columns + 1] - ValuesY [Node + Columns]);
+            SampleY [i] = Bottom + TY * (Top - Bottom);
+        }
+    }// SamplingScalar ()
+
+    void PositionComputingScalar (const float *OriginX, const float *OriginY, const float *VelX, const float *VelY,
+                                  const float *Gravity, const float *Time, float *X, float *Y, unsigned Count)
+    {
+        PositionScalar (OriginX, OriginY, VelX, VelY, Gravity, Time, X, Y, 0, Count);
+    }
+
+    void CollisionDetectionScalar (const float *X, const float *Y, unsigned *Codes, unsigned Count)
+    {
+        CollisionScalar (X, Y, Codes, 0, Count);
+    }
+
+    void GridSamplingScalar (const float *ValuesX, const float *ValuesY, unsigned Columns, unsigned Rows, float ScaleX, float ScaleY,
+                             const float *X, const float *Y, float *SampleX, float *SampleY, unsigned Count)
+    {
+        SamplingScalar (ValuesX, ValuesY, Columns, Rows, ScaleX, ScaleY, X, Y, SampleX, SampleY, 0, Count);
+    }
+
+#ifdef BATCH_X86
+
+    /*
+    ** SSE2 KERNELS, 4 BALLS PER INSTRUCTION
+    */
+
+    __attribute__ ((target ("sse2"))) BATCH_EXACT
+    void PositionComputingSSE2 (const float *OriginX, const float *OriginY, const float *VelX, const float *VelY,
+                                const float *Gravity, const float *Time, float *X, float *Y, unsigned Count)
+    {
+        const __m128 Half = _mm_set1_ps (0.5f);
+        unsigned i = 0;
+
+        for (; i + 4 <= Count; i += 4)
+        {
+            __m128 T = _mm_loadu_ps (Time + i);
+            __m128 NewX = _mm_add_ps (_mm_loadu_ps (OriginX + i), _mm_mul_ps (_mm_loadu_ps (VelX + i), T));
+            __m128 Fall = _mm_mul_ps (_mm_mul_ps (_mm_mul_ps (Half, _mm_loadu_ps (Gravity + i)), T), T);
+            __m128 NewY = _mm_sub_ps (_mm_add_ps (_mm_loadu_ps (OriginY + i), _mm_mul_ps (_mm_loadu_ps (VelY + i), T)), Fall);
+            _mm_storeu_ps (X + i, NewX);
+            _mm_storeu_ps (Y + i, NewY);
+        }
+
+        PositionScalar (OriginX, OriginY, VelX, VelY, Gravity, Time, X, Y, i, Count);
+    }
+
+    __attribute__ ((target ("sse2"))) BATCH_EXACT
+    void CollisionDetectionSSE2 (const float *X, const float *Y, unsigned *Codes, unsigned Count)
+    {
+        const __m128 Zero = _mm_setzero_ps ();
+        const __m128 Width = _mm_set1_ps (ARENA_WIDTH);
+        const __m128 Height = _mm_set1_ps (ARENA_HEIGHT);
+        unsigned i = 0;
+
+        for (; i + 4 <= Count; i += 4)
+        {
+            __m128 NewX = _mm_loadu_ps (X + i);
+            __m128 NewY = _mm_loadu_ps (Y + i);
+
+            // Every comparison gives a full mask, keep only the bit of its code.
+            __m128i Code = _mm_and_si128 (_mm_castps_si128 (_mm_cmplt_ps (NewX, Zero)), _mm_set1_epi32 (COLLISION_LEFT));
+            Code = _mm_or_si128 (Code, _mm_and_si128 (_mm_castps_si128 (_mm_cmpgt_ps (NewX, Width)), _mm_set1_epi32 (COLLISION_RIGHT)));
+            Code = _mm_or_si128 (Code, _mm_and_si128 (_mm_castps_si128 (_mm_cmplt_ps (NewY, Zero)), _mm_set1_epi32 (COLLISION_BOTTOM)));
+            Code = _mm_or_si128 (Code, _mm_and_si128 (_mm_castps_si128 (_mm_cmpgt_ps (NewY, Height)), _mm_set1_epi32 (COLLISION_TOP)));
+
+            _mm_storeu_si128 ((__m128i *) (Codes + i), Code);
+        }
+
+        CollisionScalar (X, Y, Codes, i, Count);
+    }
+
+    __attribute__ ((target ("sse2"))) BATCH_EXACT
+    void GridSamplingSSE2 (const float *ValuesX, const float *ValuesY, unsigned Columns, unsigned Rows, float ScaleX, float ScaleY,
+                           const float *X, const float *Y, float *SampleX, float *SampleY, unsigned Count)
+    {
+        const __m128 Zero = _mm_setzero_ps ();
+        const __m128 LastX = _mm_set1_ps (Columns - 1);
+        const __m128 LastY = _mm_set1_ps (Rows - 1);
+        const __m128 CellX = _mm_set1_ps (Columns - 2);
+        const __m128 CellY = _mm_set1_ps (Rows - 2);
+        const __m128 Width = _mm_set1_ps (Columns);
+        unsigned i = 0;
+
+        for (; i + 4 <= Count; i += 4)
+        {
+            __m128 GX = _mm_min_ps (_mm_max_ps (_mm_mul_ps (_mm_loadu_ps (X + i), _mm_set1_ps (ScaleX)), Zero), LastX);
+            __m128 GY = _mm_min_ps (_mm_max_ps (_mm_mul_ps (_mm_loadu_ps (Y + i), _mm_set1_ps (ScaleY)), Zero), LastY);
+            __m128 CX = _mm_min_ps (_mm_cvtepi32_ps (_mm_cvttps_epi32 (GX)), CellX);
+            __m128 CY = _mm_min_ps (_mm_cvtepi32_ps (_mm_cvttps_epi32 (GY)), CellY);
+            __m128 TX = _mm_sub_ps (GX, CX);
+            __m128 TY = _mm_sub_ps (GY, CY);
+
+            // No gather before AVX2, the nodes are read one by one.
+            alignas (16) int Nodes [4];
+            _mm_store_si128 ((__m128i *) Nodes, _mm_cvttps_epi32 (_mm_add_ps (_mm_mul_ps (CY, Width), CX)));
+
+            const float *Values [2] = {ValuesX, ValuesY};
+            float *Samples [2] = {SampleX, SampleY};
+            for (unsigned k = 0; k < 2; ++k)
+            {
+                const float *V = Values [k];
+                __m128 A = _mm_set_ps (V [Nodes [3]], V [Nodes [2]], V [Nodes [1]], V [Nodes [0]]);
+                __m128 B = _mm_set_ps (V [Nodes [3] + 1], V [Nodes [2] + 1], V [Nodes [1] + 1], V [Nodes [0] + 1]);
+                __m128 C = _mm_set_ps (V [Nodes [3] + Columns], V [Nodes [2] + Columns], V [Nodes [1] + Columns], V [Nodes [0] + Columns]);
+                __m128 D = _mm_set_ps (V [Nodes [3] + Columns + 1], V [Nodes [2] + Columns + 1], V [Nodes [1] + Columns + 1], V [Nodes [0] + Columns + 1]);
+
+                __m128 Bottom = _mm_add_ps (A, _mm_mul_ps (TX, _mm_sub_ps (B, A)));
+                __m128 Top = _mm_add_ps (C, _mm_mul_ps (TX, _mm_sub_ps (D, C)));
+                _mm_storeu_ps (Samples [k] + i, _mm_add_ps (Bottom, _mm_mul_ps (TY, _mm_sub_ps (Top, Bottom))));
+            }
+        }
+
+        SamplingScalar (ValuesX, ValuesY, Columns, Rows, ScaleX, ScaleY, X, Y, SampleX, SampleY, i, Count);
+    }
+
+    /*
+    ** AVX2 KERNELS, 8 BALLS PER INSTRUCTION
+    */
+
+    __attribute__ ((target ("avx2"))) BATCH_EXACT
+    void PositionComputingAVX2 (const float *OriginX, const float *OriginY, const float *VelX, const float *VelY,
+                                const float *Gravity, const float *Time, float *X, float *Y, unsigned Count)
+    {
+        const __m256 Half = _mm256_set1_ps (0.5f);
+        unsigned i = 0;
+
+        for (; i + 8 <= Count; i += 8)
+        {
+            __m256 T = _mm256_loadu_ps (Time + i);
+            __m256 NewX = _mm256_add_ps (_mm256_loadu_ps (OriginX + i), _mm256_mul_ps (_mm256_loadu_ps (VelX + i), T));
+            __m256 Fall = _mm256_mul_ps (_mm256_mul_ps (_mm256_mul_ps (Half, _mm256_loadu_ps (Gravity + i)), T), T);
+            __m256 NewY = _mm256_sub_ps (_mm256_add_ps (_mm256_loadu_ps (OriginY + i), _mm256_mul_ps (_mm256_loadu_ps (VelY + i), T)), Fall);
+            _mm256_storeu_ps (X + i, NewX);
+            _mm256_storeu_ps (Y + i, NewY);
+        }
+
+        PositionScalar (OriginX, OriginY, VelX, VelY, Gravity, Time, X, Y, i, Count);
+    }
+
+    __attribute__ ((target ("avx2"))) BATCH_EXACT
+    void CollisionDetectionAVX2 (const float *X, const float *Y, unsigned *Codes, unsigned Count)
+    {
+        const __m256 Zero = _mm256_setzero_ps ();
+        const __m256 Width = _mm256_set1_ps (ARENA_WIDTH);
+        const __m256 Height = _mm256_set1_ps (ARENA_HEIGHT);
+        unsigned i = 0;
+
+        for (; i + 8 <= Count; i += 8)
+        {
+            __m256 NewX = _mm256_loadu_ps (X + i);
+            __m256 NewY = _mm256_loadu_ps (Y + i);
+
+            // Every comparison gives a full mask, keep only the bit of its code.
+            __m256i Code = _mm256_and_si256 (_mm256_castps_si256 (_mm256_cmp_ps (NewX, Zero, _CMP_LT_OQ)), _mm256_set1_epi32 (COLLISION_LEFT));
+            Code = _mm256_or_si256 (Code, _mm256_and_si256 (_mm256_castps_si256 (_mm256_cmp_ps (NewX, Width, _CMP_GT_OQ)), _mm256_set1_epi32 (COLLISION_RIGHT)));
+            Code = _mm256_or_si256 (Code, _mm256_and_si256 (_mm256_castps_si256 (_mm256_cmp_ps (NewY, Zero, _CMP_LT_OQ)), _mm256_set1_epi32 (COLLISION_BOTTOM)));
+            Code = _mm256_or_si256 (Code, _mm256_and_si256 (_mm256_castps_si256 (_mm256_cmp_ps (NewY, Height, _CMP_GT_OQ)), _mm256_set1_epi32 (COLLISION_TOP)));
+
+            _mm256_storeu_si256 ((__m256i *) (Codes + i), Code);
+        }
+
+        CollisionScalar (X, Y, Codes, i, Count);
+    }
+
+    __attribute__ ((target ("avx2"))) BATCH_EXACT
+    void GridSamplingAVX2 (const float *ValuesX, const float *ValuesY, unsigned Columns, unsigned Rows, float ScaleX, float ScaleY,
+                           const float *X, const float *Y, float *SampleX, float *SampleY, unsigned Count)
+    {
+        const __m256 Zero = _mm256_setzero_ps ();
+        const __m256 LastX = _mm256_set1_ps (Columns - 1);
+        const __m256 LastY = _mm256_set1_ps (Rows - 1);
+        const __m256 CellX = _mm256_set1_ps (Columns - 2);
+        const __m256 CellY = _mm256_set1_ps (Rows - 2);
+        const __m256 Width = _mm256_set1_ps (Columns);
+        const __m256i One = _mm256_set1_epi32 (1);
+        const __m256i Up = _mm256_set1_epi32 (Columns);
+        unsigned i = 0;
+
+        for (; i + 8 <= Count; i += 8)
+        {
+            __m256 GX = _mm256_min_ps (_mm256_max_ps (_mm256_mul_ps (_mm256_loadu_ps (X + i), _mm256_set1_ps (ScaleX)), Zero), LastX);
+            __m256 GY = _mm256_min_ps (_mm256_max_ps (_mm256_mul_ps (_mm256_loadu_ps (Y + i), _mm256_set1_ps (ScaleY)), Zero), LastY);
+            __m256 CX = _mm256_min_ps (_mm256_cvtepi32_ps (_mm256_cvttps_epi32 (GX)), CellX);
+            __m256 CY = _mm256_min_ps (_mm256_cvtepi32_ps (_mm256_cvttps_epi32 (GY)), CellY);
+            __m256 TX = _mm256_sub_ps (GX, CX);
+            __m256 TY = _mm256_sub_ps (GY, CY);
+
+            // The four nodes around each point are gathered.
+            __m256i NodeA = _mm256_cvttps_epi32 (_mm256_add_ps (_mm256_mul_ps (CY, Width), CX));
+            __m256i NodeB = _mm256_add_epi32 (NodeA, One);
+            __m256i NodeC = _mm256_add_epi32 (NodeA, Up);
+            __m256i NodeD = _mm256_add_epi32 (NodeC, One);
+
+            const float *Values [2] = {ValuesX, ValuesY};
+            float *Samples [2] = {SampleX, SampleY};
+            for (unsigned k = 0; k < 2; ++k)
+            {
+                __m256 A = _mm256_i32gather_ps (Values [k], NodeA, 4);
+                __m256 B = _mm256_i32gather_ps (Values [k], NodeB, 4);
+                __m256 C = _mm256_i32gather_ps (Values [k], NodeC, 4);
+                __m256 D = _mm256_i32gather_ps (Values [k], NodeD, 4);
+
+                __m256 Bottom = _mm256_add_ps (A, _mm256_mul_ps (TX, _mm256_sub_ps (B, A)));
+                __m256 Top = _mm256_add_ps (C, _mm256_mul_ps (TX, _mm256_sub_ps (D, C)));
+                _mm256_storeu_ps (Samples [k] + i, _mm256_add_ps (Bottom, _mm256_mul_ps (TY, _mm256_sub_ps (Top, Bottom))));
+            }
+        }
+
+        SamplingScalar (ValuesX, ValuesY, Columns, Rows, ScaleX, ScaleY, X, Y, SampleX, SampleY, i, Count);
+    }
+
+    /*
+    ** AVX-512 KERNELS, 16 BALLS PER INSTRUCTION
+    */
+
+    __attribute__ ((target ("avx512f"))) BATCH_EXACT
+    void PositionComputingAVX512 (const float *OriginX, const float *OriginY, const float *VelX, const float *VelY,
+                                  const float *Gravity, const float *Time, float *X, float *Y, unsigned Count)
+    {
+        const __m512 Half = _mm512_set1_ps (0.5f);
+        unsigned i = 0;
+
+        for (; i + 16 <= Count; i += 16)
+        {
+            __m512 T = _mm512_loadu_ps (Time + i);
+            __m512 NewX = _mm512_add_ps (_mm512_loadu_ps (OriginX + i), _mm512_mul_ps (_mm512_loadu_ps (VelX + i), T));
+            __m512 Fall = _mm512_mul_ps (_mm512_mul_ps (_mm512_mul_ps (Half, _mm512_loadu_ps (Gravity + i)), T), T);
+            __m512 NewY = _mm512_sub_ps (_mm512_add_ps (_mm512_loadu_ps (OriginY + i), _mm512_mul_ps (_mm512_loadu_ps (VelY + i), T)), Fall);
+            _mm512_storeu_ps (X + i, NewX);
+            _mm512_storeu_ps (Y + i, NewY);
+        }
+
+        PositionScalar (OriginX, OriginY, VelX, VelY, Gravity, Time, X, Y, i, Count);
+    }
+
+    __attribute__ ((target ("avx512f"))) BATCH_EXACT
+    void CollisionDetectionAVX512 (const float *X, const float *Y, unsigned *Codes, unsigned Count)
+    {
+        const __m512 Zero = _mm512_setzero_ps ();
+        const __m512 Width = _mm512_set1_ps (ARENA_WIDTH);
+        const __m512 Height = _mm512_set1_ps (ARENA_HEIGHT);
+        unsigned i = 0;
+
+        for (; i + 16 <= Count; i += 16)
+        {
+            __m512 NewX = _mm512_loadu_ps (X + i);
+            __m512 NewY = _mm512_loadu_ps (Y + i);
+
+            // Every comparison gives a bit mask, use it to select the code of the lanes.
+            __m512i Code = _mm512_maskz_mov_epi32 (_mm512_cmp_ps_mask (NewX, Zero, _CMP_LT_OQ), _mm512_set1_epi32 (COLLISION_LEFT));
+            Code = _mm512_mask_or_epi32 (Code, _mm512_cmp_ps_mask (NewX, Width, _CMP_GT_OQ), Code, _mm512_set1_epi32 (COLLISION_RIGHT));
+            Code = _mm512_mask_or_epi32 (Code, _mm512_cmp_ps_mask (NewY, Zero, _CMP_LT_OQ), Code, _mm512_set1_epi32 (COLLISION_BOTTOM));
+            Code = _mm512_mask_or_epi32 (Code, _mm512_cmp_ps_mask (NewY, Height, _CMP_GT_OQ), Code, _mm512_set1_epi32 (COLLISION_TOP));
+
+            _mm512_storeu_si512 ((void *) (Codes + i), Code);
+        }
+
+        CollisionScalar (X, Y, Codes, i, Count);
+    }
+
+    __attribute__ ((target ("avx512f"))) BATCH_EXACT
+    void GridSamplingAVX512 (const float *ValuesX, const float *ValuesY, unsigned Columns, unsigned Rows, float ScaleX, float ScaleY,
+                             const float *X, const float *Y, float *SampleX, float *SampleY, unsigned Count)
+    {
+        const __m512 Zero = _mm512_setzero_ps ();
+        const __m512 LastX = _mm512_set1_ps (Columns - 1);
+        const __m512 LastY = _mm512_set1_ps (Rows - 1);
+        const __m512 CellX = _mm512_set1_ps (Columns - 2);
+        const __m512 CellY = _mm512_set1_ps (Rows - 2);
+        const __m512 Width = _mm512_set1_ps (Columns);
+        const __m512i One = _mm512_set1_epi32 (1);
+        const __m512i Up = _mm512_set1_epi32 (Columns);
+        const __mmask16 All = 0xFFFF;
+        unsigned i = 0;
+
+        // The masked forms on every lane do not read an undefined register as the unmasked ones do in some compilers.
+        for (; i + 16 <= Count; i += 16)
+        {
+            __m512 GX = _mm512_maskz_min_ps (All, _mm512_maskz_max_ps (All, _mm512_mul_ps (_mm512_loadu_ps (X + i), _mm512_set1_ps (ScaleX)), Zero), LastX);
+            __m512 GY = _mm512_maskz_min_ps (All, _mm512_maskz_max_ps (All, _mm512_mul_ps (_mm512_loadu_ps (Y + i), _mm512_set1_ps (ScaleY)), Zero), LastY);
+            __m512 CX = _mm512_maskz_min_ps (All, _mm512_maskz_cvtepi32_ps (All, _mm512_maskz_cvttps_epi32 (All, GX)), CellX);
+            __m512 CY = _mm512_maskz_min_ps (All, _mm512_maskz_cvtepi32_ps (All, _mm512_maskz_cvttps_epi32 (All, GY)), CellY);
+            __m512 TX = _mm512_sub_ps (GX, CX);
+            __m512 TY = _mm512_sub_ps (GY, CY);
+
+            // The four nodes around each point are gathered.
+            __m512i NodeA = _mm512_maskz_cvttps_epi32 (All, _mm512_add_ps (_mm512_mul_ps (CY, Width), CX));
+            __m512i NodeB = _mm512_add_epi32 (NodeA, One);
+            __m512i NodeC = _mm512_add_epi32 (NodeA, Up);
+            __m512i NodeD = _mm512_add_epi32 (NodeC, One);
+
+            const float *Values [2] = {ValuesX, ValuesY};
+            float *Samples [2] = {SampleX, SampleY};
+            for (unsigned k = 0; k < 2; ++k)
+            {
+                __m512 A = _mm512_mask_i32gather_ps (Zero, All, NodeA, Values [k], 4);
+                __m512 B = _mm512_mask_i32gather_ps (Zero, All, NodeB, Values [k], 4);
+                __m512 C = _mm512_mask_i32gather_ps (Zero, All, NodeC, Values [k], 4);
+                __m512 D = _mm512_mask_i32gather_ps (Zero, All, NodeD, Values [k], 4);
+
+                __m512 Bottom = _mm512_add_ps (A, _mm512_mul_ps (TX, _mm512_sub_ps (B, A)));
+                __m512 Top = _mm512_add_ps (C, _mm512_mul_ps (TX, _mm512_sub_ps (D, C)));
+                _mm512_storeu_ps (Samples [k] + i, _mm512_add_ps (Bottom, _mm512_mul_ps (TY, _mm512_sub_ps (Top, Bottom))));
+            }
+        }
+
+        SamplingScalar (ValuesX, ValuesY, Columns, Rows, ScaleX, ScaleY, X, Y, SampleX, SampleY, i, Count);
+    }
+
+#endif // BATCH_X86
+
+    /*
+    ** RUNTIME DISPATCH
+    */
+
+    typedef void (*PositionKernel) (const float *, const float *, const float *, const float *,
+                                    const float *, const float *, float *, float *, unsigned);
+    typedef void (*CollisionKernel) (const float *, const float *, unsigned *, unsigned);
+    typedef void (*SamplingKernel) (const float *, const float *, unsigned, unsigned, float, float,
+                                    const float *, const float *, float *, float *, unsigned);
+
+    // The kernels currently used.
+    struct Dispatch
+    {
+        SimdLevel Level;
+        PositionKernel Position;
+        CollisionKernel Collision;
+        SamplingKernel Sampling;
+    };
+
+    // Detect the best instruction set supported by the CPU.
+    SimdLevel DetectSimdLevel ()
+    {
+#ifdef BATCH_X86
+        __builtin_cpu_init ();
+
+        if (__builtin_cpu_supports ("avx512f"))
+            return SIMD_AVX512;
+        if (__builtin_cpu_supports ("avx2"))
+            return SIMD_AVX2;
+        if (__builtin_cpu_supports ("sse2"))
+            return SIMD_SSE2;
+#endif
+        return SIMD_SCALAR;
+    }
+
+    // Select the kernels of an instruction set.
+    void SelectKernels (Dispatch &Table, SimdLevel Level)
+    {
+        Table.Level = SIMD_SCALAR;
+        Table.Position = PositionComputingScalar;
+        Table.Collision = CollisionDetectionScalar;
+        Table.Sampling = GridSamplingScalar;
+
+#ifdef BATCH_X86
+        if (Level == SIMD_AVX512)
+        {
+            Table.Level = SIMD_AVX512;
+            Table.Position = PositionComputingAVX512;
+            Table.Collision = CollisionDetectionAVX512;
+            Table.Sampling = GridSamplingAVX512;
+        }
+        else if (Level == SIMD_AVX2)
+        {
+            Table.Level = SIMD_AVX2;
+            Table.Position = PositionComputingAVX2;
+            Table.Collision = CollisionDetectionAVX2;
+            Table.Sampling = GridSamplingAVX2;
+        }
+        else if (Level == SIMD_SSE2)
+        {
+            Table.Level = SIMD_SSE2;
+            Table.Position = PositionComputingSSE2;
+            Table.Collision = CollisionDetectionSSE2;
+            Table.Sampling = GridSamplingSSE2;
+        }
+#endif
+    }
+
+    // Return the kernels table, initialized with the best instruction set on first call.
+    Dispatch &GetDispatch ()
+    {
+        static Dispatch Table = []
+        {
+            Dispatch Best;
+            SelectKernels (Best, DetectSimdLevel ());
+            return Best;
+        } ();
+
+        return Table;
+    }
+}
+
+// Will return the (x, y) coordinates of Count balls.
+void nsTools::BatchPositionComputing (const float *OriginX, const float *OriginY, const float *VelX, const float *VelY,
+                                      const float *Gravity, const float *Time, float *X, float *Y, unsigned Count) throw ()
+{
+    GetDispatch ().Position (OriginX, OriginY, VelX, VelY, Gravity, Time, X, Y, Count);
+
+}// BatchPositionComputing ()
+
+// Collision detection of Count balls on the walls and on the floor and roof, without branch.
+void nsTools::BatchCollisionDetection (const float *X, const float *Y, unsigned *Codes, unsigned Count) throw ()
+{
+    GetDispatch ().Collision (X, Y, Codes, Count);
+
+}// BatchCollisionDetection ()
+
+// Bilinear interpolation of the vectors of a grid at Count points.
+void nsTools::BatchGridSampling (const float *ValuesX, const float *ValuesY, unsigned Columns, unsigned Rows, float ScaleX, float ScaleY,
+                                 const float *X, const float *Y, float *SampleX, float *SampleY, unsigned Count) throw ()
+{
+    GetDispatch ().Sampling (ValuesX, ValuesY, Columns, Rows, ScaleX, ScaleY, X, Y, SampleX, SampleY, Count);
+
+}// BatchGridSampling ()
+
+// Return the best instruction set supported by the CPU.
+SimdLevel nsTools::GetSupportedSimdLevel () throw ()
+{
+    static SimdLevel Supported = DetectSimdLevel ();
+
+    return Supported;
+
+}// GetSupportedSimdLevel ()
+
+// Return the instruction set currently used.
+SimdLevel nsTools::GetSimdLevel () throw ()
+{
+    return GetDispatch ().Level;
+
+}// GetSimdLevel ()
+
+// Force an instruction set, limited to the one supported by the CPU.
+SimdLevel nsTools::SetSimdLevel (SimdLevel Level) throw ()
+{
+    if (Level > GetSupportedSimdLevel ())
+        Level = GetSupportedSimdLevel ();
+
+    SelectKernels (GetDispatch (), Level);
+
+    return Level;
+
+}// SetSimdLevel ()
+
+// Return the name of an instruction set.
+const char *nsTools::GetSimdLevelName (SimdLevel Level) throw ()
+{
+    if (Level == SIMD_AVX512)
+        return "AVX-512";
+    if (Level == SIMD_AVX2)
+        return "AVX2";
+    if (Level == SIMD_SSE2)
+        return "SSE2";
+
+    return "scalaire";
+
+}// GetSimdLevelName ()
@@ -0,0 +1,55 @@
+/**
+ *
+ * @file batch.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Batch header file.
+ *
+ * @details Contain declaration of the batched trajectory, collision and grid sampling functions.
+ *          They evaluate 4, 8 or 16 balls per instruction (SSE2, AVX2 or AVX-512), the instruction set
+ *          being selected at runtime depending on the CPU.
+ *
+ * @see batch.cpp
+ *
+ **/
+
+#ifndef __BATCH_H__
+#define __BATCH_H__
+
+#include "common.h"     // COLLISION codes
+
+namespace nsTools
+{
+    // The allowed instruction sets.
+    typedef enum{SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2, SIMD_AVX512} SimdLevel;
+
+    // Will return the (x, y) coordinates of Count balls, X = OriginX + VelX * Time and Y = OriginY + VelY * Time - Gravity * Time * Time / 2.
+    void BatchPositionComputing (const float *OriginX, const float *OriginY, const float *VelX, const float *VelY,
+                                 const float *Gravity, const float *Time, float *X, float *Y, unsigned Count) throw ();
+
+    // Collision detection of Count balls on the walls (code & 3) and on the floor and roof (code >> 2), without branch.
+    void BatchCollisionDetection (const float *X, const float *Y, unsigned *Codes, unsigned Count) throw ();
+
+    // Bilinear interpolation of the vectors (ValuesX, ValuesY) of a grid of Columns x Rows nodes, stored row after row, at Count points.
+    // The point (X, Y) is at (X * ScaleX, Y * ScaleY) in nodes, the points out of the grid take the values of its border.
+    void BatchGridSampling (const float *ValuesX, const float *ValuesY, unsigned Columns, unsigned Rows, float ScaleX, float ScaleY,
+                            const float *X, const float *Y, float *SampleX, float *SampleY, unsigned Count) throw ();
+
+    // Return the best instruction set supported by the CPU.
+    SimdLevel GetSupportedSimdLevel () throw ();
+
+    // Return the instruction set currently used.
+    SimdLevel GetSimdLevel () throw ();
+
+    // Force an instruction set, limited to the one supported by the CPU. Return the selected one.
+    SimdLevel SetSimdLevel (SimdLevel Level) throw ();
+
+    // Return the name of an instruction set.
+    const char *GetSimdLevelName (SimdLevel Level) throw ();
+}
+#endif // __BATCH_H__
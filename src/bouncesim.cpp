@@ -0,0 +1,1601 @@
+/**
+ *
+ * @file bouncesim.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Command line simulator source file.
+ *
+ * @details Contain the main () of the bounce-sim target. It steps a scenario with the headless
+ *          simulation engine as fast as the CPU allows, without any window or frame rate limit.
+ *
+ * @see CSimulation.h
+ *
+ **/
+
+#include <iostream>     // std::cout
+#include <string>       // std::string
+#include <cstdlib>      // atof, atol, strtod, strtol, strtoull
+#include <algorithm>    // std::max, std::min_element, std::max_element
+#include <chrono>       // std::chrono
+#include <vector>       // std::vector
+#include <fstream>      // std::ofstream
+#include <math.h>       // sin, cos, acos, fabs, sqrt
+
+#include "CSimulation.h"        // Headless simulation engine
+#include "CEventSimulation.h"   // Event driven simulation engine
+#include "CTrajectory.h"        // Closed form of the trajectory
+#include "CWorld.h"             // Multi-ball world
+#include "CEventWorld.h"        // Event driven multi-ball world
+#include "CSegmentTree.h"       // Static segments
+#include "CPegBoard.h"          // Field of pegs
+#include "CTerrain.h"           // Uneven floor
+#include "CForceField.h"        // Force field
+#include "CIntegrator.h"        // Drag integration
+#include "CSweep.h"             // Parameter sweep
+#include "CJobSystem.h"         // Job system
+#include "CMonteCarlo.h"        // Monte Carlo study
+#include "CAdaptiveSweep.h"     // Adaptive sweep of the angles and speeds
+#include "physics.h"            // PositionComputing
+#include "batch.h"              // Instruction set selection
+#include "fastmath.h"           // Math precision selection
+#include "common.h"             // Settings struct, BallState struct, PI
+
+using namespace std;
+using namespace nsTools;
+
+namespace
+{
+    // Store the command line options.
+    struct Options
+    {
+        float TimeStep;         // the time step of the simulation.
+        float MaxTime;          // the maximum simulated time.
+        unsigned long MaxSteps; // the maximum number of steps, 0 for no limit.
+        unsigned BallNumber;    // the number of balls of the world, 0 for the single ball simulation.
+        float Spread;           // the angle between the first and the last ball of the world.
+        float Radius;           // the radius of the balls of the world, 0 for points.
+        unsigned Iterations;    // the number of passes of the contact solver, 0 for the bounces of the pairs of balls.
+        unsigned ThreadCount;   // the maximum number of threads, 0 for one per core.
+        bool Events;            // tells if the event driven engine is used.
+        bool MathReport;        // tells if the accuracy of every math precision is reported.
+        bool Checking;          // tells if the behaviours of the engines are checked.
+        unsigned Queries;       // the number of times where the closed form is queried, 0 for none.
+        string SegmentFile;     // the file of the static segments, empty for none.
+        string PegFile;         // the file of the pegs, empty for none.
+        string TerrainFile;     // the file of the heights of the floor, empty for the flat one.
+        string FieldFile;       // the file of the force field, empty for none.
+        unsigned long Drops;    // the number of balls dropped through the pegs.
+        float EmitRate;         // the number of balls launched per second into the world, 0 to launch them all at once.
+        float LifeTime;         // the time the launched balls stay in the world.
+        unsigned ChainLength;   // the number of balls of the chains, 0 or 1 for free balls.
+        float Stiffness;        // the stiffness of the links of the chains, 0 for rods.
+        bool Integrating;       // tells if the flight of the single ball is integrated instead of following the parabola.
+        CIntegrator::Method Method; // the integration method.
+        float LinearDrag;       // the drag proportional to the velocity (1/s).
+        float QuadraticDrag;    // the drag proportional to the velocity and the speed (1/m).
+        float Tolerance;        // the error of a step of the adaptive integration.
+        bool IntegratorReport;  // tells if the accuracy and the speed of every integrator are reported.
+        float Budget;           // the largest error of a flight allowed by the integrator report.
+        bool Sweeping;          // tells if the settings are swept.
+        std::vector <float> Sweep [CSweep::FIELD_COUNT]; // the swept values of each field, empty for the single value of the options.
+        string TableFile;       // the file of the results of the sweep, empty for none.
+        unsigned long long Samples; // the number of samples of the Monte Carlo study, 0 for none.
+        CMonteCarlo::Distribution Laws [CMonteCarlo::FIELD_COUNT]; // the law of each field of the study.
+        unsigned long long Seed;    // the seed of the random generator.
+        unsigned BinCount;      // the number of bins of the histograms of the study and the sweep.
+        bool Progress;          // tells if the study displays the samples already run.
+        unsigned RefineLevel;   // the finest level of the adaptive sweep, 0 for none.
+        unsigned FirstLevel;    // the level of the first grid of the adaptive sweep.
+        float RefineAngles [2]; // the angles swept by the adaptive sweep (rad).
+        float RefineSpeeds [2]; // the speeds swept by the adaptive sweep.
+        string TreeFile;        // the file of the leaves of the adaptive sweep, empty for none.
+        string BoundaryFile;    // the file of the finest cells on the boundaries of the outcomes, empty for none.
+    };
+
+    // Width (m) of the band, in the middle of the arena, the balls are dropped from through the pegs.
+    const float DropWidth = 1;
+
+    // Duration (s) of the free flights of the integrator report, and the drag used there if none is given.
+    const double FlightTime = 5;
+    const double ReportLinearDrag = 0.05;
+    const double ReportQuadraticDrag = 0.01;
+
+    // Return the time elapsed since Beginning, in seconds.
+    double ElapsedSince (chrono::steady_clock::time_point Beginning)
+    {
+        return chrono::duration <double> (chrono::steady_clock::now () - Beginning).count ();
+
+    }// ElapsedSince ()
+
+    // Will display the allowed options.
+    void Usage (const char *Name)
+    {
+        cout << "Utilisation : " << Name << " [options]" << endl
+             << "  --speed V     vitesse initiale (m/s, defaut 20)" << endl
+             << "  --angle A     angle de lancement (degres, defaut 45)" << endl
+             << "  --pos Y       position initiale en y (defaut 20)" << endl
+             << "  --gravity G   gravite (defaut 9.81)" << endl
+             << "  --coef C      coefficient de restitution (defaut 0.85)" << endl
+             << "  --dt T        pas de temps (s, defaut 0.02)" << endl
+             << "  --time T      temps maximum simule (s, defaut 600)" << endl
+             << "  --steps N     nombre maximum de pas (defaut illimite)" << endl
+             << "  --balls N     simule N balles dans un meme monde (defaut 1)" << endl
+             << "  --spread A    ecart d'angle entre la premiere et la derniere balle (degres, defaut 0)" << endl
+             << "  --radius R    rayon des balles, qui se heurtent alors entre elles (defaut 0)" << endl
+             << "  --solver N    resout ensemble les contacts entre balles en N passes, les tas de balles restent immobiles (defaut 0 : chocs deux a deux)" << endl
+             << "  --threads T   nombre maximum de threads (defaut un par coeur)" << endl
+             << "  --segments F  segments fixes lus dans le fichier F, une ligne \"x1 y1 x2 y2 [coef]\" par segment (sans --events)" << endl
+             << "  --terrain F   sol inegal dont les hauteurs, reparties regulierement d'un mur a l'autre, sont lues dans le fichier F (sans --events)" << endl
+             << "  --field F     champ de forces (vent, attracteurs) lu dans le fichier F : colonnes et lignes, puis \"ax ay\" par noeud (sans --events)" << endl
+             << "  --pegs F      lache les balles au milieu de l'arene a travers les clous lus dans le fichier F, une ligne \"x y rayon [coef]\" par clou" << endl
+             << "  --drops N     nombre de balles lachees a travers les clous (defaut 10000)" << endl
+             << "  --emit N      lance N balles par seconde l'une apres l'autre (--balls : nombre maximum de balles presentes)" << endl
+             << "  --life T      temps passe par les balles lancees avant d'etre retirees (s, defaut 10)" << endl
+             << "  --chain K     relie les balles voisines en chaines de K balles (avec --radius, sans --emit)" << endl
+             << "  --stiffness S raideur des liens des chaines (N/m, defaut 0 : tiges rigides)" << endl
+             << "  --integrator M integre le vol de la balle seule : euler, verlet, rk4, rk45 (defaut : parabole exacte, rk4 avec frottement)" << endl
+             << "  --drag K      frottement de l'air proportionnel au carre de la vitesse (1/m, defaut 0)" << endl
+             << "  --drag-linear K frottement de l'air proportionnel a la vitesse (1/s, defaut 0)" << endl
+             << "  --tolerance E erreur maximum d'un pas de rk45 (defaut 1e-6)" << endl
+             << "  --integrator-report precision et vitesse de chaque integrateur, et le moins cher sous --budget" << endl
+             << "  --budget E    ecart maximum de position apres un vol de 5 s pour --integrator-report (m, defaut 0.001)" << endl
+             << "  --sweep-speed L, --sweep-angle L, --sweep-pos L, --sweep-gravity L, --sweep-coef L" << endl
+             << "                balaie les valeurs L (\"a,b,c\" ou \"debut:fin:nombre\") sur tous les coeurs, toutes les combinaisons" << endl
+             << "                sont simulees jusqu'a --time" << endl
+             << "  --table F     ecrit le resultat de chaque execution du balayage dans le fichier F" << endl
+             << "  --mc N        lance N balles dont les reglages suivent les lois de --mc-speed, --mc-angle, --mc-pos, --mc-gravity" << endl
+             << "                et --mc-coef (\"uniform:min:max\" ou \"normal:moyenne:ecart\"), et donne les distributions des points" << endl
+             << "                et temps de chute et des temps avant de se poser jusqu'a --time" << endl
+             << "  --seed S      graine du generateur aleatoire (defaut 0)" << endl
+             << "  --progress    affiche l'avancement de --mc" << endl
+             << "  --refine L    carte des rebonds et du premier mur touche selon l'angle et la vitesse, les cellules dont les coins" << endl
+             << "                different sont coupees en quatre jusqu'a 2^L cellules par cote (L au plus 15)" << endl
+             << "  --refine-start K grille de depart de 2^K cellules par cote (defaut 3)" << endl
+             << "  --refine-angle a:b, --refine-speed a:b angles (degres, defaut 0:90) et vitesses (defaut 0:40) de la carte" << endl
+             << "  --tree F      ecrit les feuilles de la carte dans le fichier F" << endl
+             << "  --boundary F  ecrit le centre des plus petites cellules sur les frontieres dans le fichier F" << endl
+             << "  --bins N      nombre de classes des histogrammes de --mc et du balayage (defaut 20)" << endl
+             << "  --simd S      jeu d'instructions : scalar, sse2, avx2, avx512 (defaut le meilleur disponible)" << endl
+             << "  --events      saute directement d'un rebond au suivant (calcul exact des impacts), avec --balls aussi d'un choc au suivant" << endl
+             << "  --at N        etat de la balle a N instants entre 0 et le temps maximum, sans simuler les rebonds" << endl
+             << "  --math P      precision des fonctions trigonometriques : exact, 1e-6, 1e-4 (defaut exact)" << endl
+             << "  --math-report erreur et vitesse de chaque precision, sur les fonctions et sur les trajectoires" << endl
+             << "  --check       verifie les comportements attendus des moteurs sur le scenario par defaut, rend une erreur si l'un d'eux manque" << endl;
+
+    }// Usage ()
+
+    // Read a list of values "a,b,c" or a range "first:last:count", each value multiplied by Scale. Return false if the text is wrong.
+    bool ParseValues (const char *Text, float Scale, std::vector <float> &Values)
+    {
+        string List (Text);
+        Values.clear ();
+
+        // Every value must be read up to its separator.
+        char *End;
+        if (List.find (':') != string::npos)
+        {
+            float First = strtod (Text, &End);
+            if (*End != ':')
+                return false;
+            float Last = strtod (End + 1, &End);
+            if (*End != ':')
+                return false;
+            long Count = strtol (End + 1, &End, 10);
+            if (*End != 0 || Count < 1)
+                return false;
+
+            for (long i = 0; i < Count; ++i)
+                Values.push_back (Scale * (Count > 1 ? First + (Last - First) * i / (Count - 1) : First));
+
+            return true;
+        }
+
+        for (const char *Value = Text;; Value = End + 1)
+        {
+            Values.push_back (Scale * strtod (Value, &End));
+            if (End == Value || (*End != ',' && *End != 0))
+                return false;
+            if (*End == 0)
+                return true;
+        }
+
+    }// ParseValues ()
+
+    // Read a law "uniform:min:max" or "normal:mean:deviation", the values are multiplied by Scale.
+    bool ParseDistribution (const char *Text, float Scale, CMonteCarlo::Distribution &Law)
+    {
+        string Description (Text);
+        string::size_type Colon = Description.find (':');
+        if (Colon == string::npos)
+            return false;
+
+        string Name (Description, 0, Colon);
+        if (Name == "uniform")
+            Law.Kind = CMonteCarlo::UNIFORM;
+        else if (Name == "normal")
+            Law.Kind = CMonteCarlo::NORMAL;
+        else
+            return false;
+
+        // Both values must be read up to their separator.
+        char *End;
+        Law.A = Scale * strtod (Text + Colon + 1, &End);
+        if (End == Text + Colon + 1 || *End != ':')
+            return false;
+        const char *Second = End + 1;
+        Law.B = Scale * strtod (Second, &End);
+        if (End == Second || *End != 0)
+            return false;
+
+        // The bounds must be in order, the deviation not negative.
+        return Law.Kind == CMonteCarlo::UNIFORM ? Law.A <= Law.B : Law.B >= 0;
+
+    }// ParseDistribution ()
+
+    // Display the distribution of an outcome of the Monte Carlo study or of the sweep.
+    void DisplayOutcome (const char *Name, const CStatistics &Current)
+    {
+        cout << Name << " : " << Current.GetCount () << " balles" << endl;
+        if (Current.GetCount () == 0)
+            return;
+
+        cout << "  Moyenne : " << Current.GetMean () << endl
+             << "  Ecart type : " << sqrt (Current.GetVariance ()) << endl
+             << "  Minimum : " << Current.GetMin () << endl
+             << "  Maximum : " << Current.GetMax () << endl
+             << "  Quantiles 5%, 50%, 95% : " << Current.GetQuantile (0.05) << ' ' << Current.GetQuantile (0.5) << ' ' << Current.GetQuantile (0.95) << endl;
+
+        // The values out of the bounds of the histogram are in its first or last bin.
+        const std::vector <unsigned long long> &Bins = Current.GetBins ();
+        double Width = (Current.GetHigh () - Current.GetLow ()) / Bins.size ();
+        for (unsigned i = 0; i < Bins.size (); ++i)
+            if (Bins [i] > 0)
+                cout << "  " << Current.GetLow () + i * Width << " a " << Current.GetLow () + (i + 1) * Width << " : " << Bins [i] << endl;
+
+    }// DisplayOutcome ()
+
+    // Launch balls with settings drawn at random and display the distributions of their outcomes.
+    int RunMonteCarlo (const Settings &Parameters, const Options &Opts)
+    {
+        CMonteCarlo Study (Parameters, Opts.MaxTime, Opts.Seed);
+        Study.SetThreadCount (Opts.ThreadCount);
+        Study.SetBinCount (Opts.BinCount);
+
+        for (unsigned i = 0; i < CMonteCarlo::FIELD_COUNT; ++i)
+            Study.SetDistribution ((CMonteCarlo::Field) i, Opts.Laws [i]);
+
+        // The report of the samples already run is given after each round of blocks.
+        if (Opts.Progress)
+            Study.SetProgress ([&Opts] (const CMonteCarlo::Report &Current)
+            {
+                cout << "Progression : " << Current.Samples << " / " << Opts.Samples << " echantillons, temps moyen avant de se poser : "
+                     << Current.RestTime.GetMean () << endl;
+            });
+
+        CMonteCarlo::Report Result;
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        Study.Run (Opts.Samples, Result);
+
+        double Elapsed = ElapsedSince (Beginning);
+
+        cout << "Echantillons : " << Result.Samples << endl
+             << "Graine : " << Opts.Seed << endl
+             << "Temps etudie : " << Opts.MaxTime << endl
+             << "Temps de calcul (s) : " << Elapsed << endl;
+
+        if (Elapsed > 0)
+            cout << "Echantillons par seconde : " << Result.Samples / Elapsed << endl;
+
+        DisplayOutcome ("Points de chute (m)", Result.LandingX);
+        DisplayOutcome ("Temps de chute (s)", Result.LandingTime);
+        DisplayOutcome ("Temps avant de se poser (s)", Result.RestTime);
+        DisplayOutcome ("Rebonds", Result.Bounces);
+
+        return 0;
+
+    }// RunMonteCarlo ()
+
+    // Read a range "first:last", the values are multiplied by Scale.
+    bool ParseRange (const char *Text, float Scale, float Range [2])
+    {
+        // Both values must be read up to their separator.
+        char *End;
+        Range [0] = Scale * strtod (Text, &End);
+        if (End == Text || *End != ':')
+            return false;
+        const char *Second = End + 1;
+        Range [1] = Scale * strtod (Second, &End);
+
+        return End != Second && *End == 0 && Range [0] <= Range [1];
+
+    }// ParseRange ()
+
+    // Map the outcomes over the angles and the speeds, densely only where they change.
+    int RunAdaptiveSweep (const Settings &Parameters, const Options &Opts)
+    {
+        // The closed form needs a gravity not negative, and bounces losing energy not to follow the roof bounces forever.
+        if (Parameters.Gravity < 0 || Parameters.RestitutionCoef < 0 || Parameters.RestitutionCoef >= 1)
+        {
+            cout << "Erreur: la carte demande une gravite positive ou nulle et un coefficient entre 0 et 1 (exclu)." << endl;
+            return -1;
+        }
+
+        CAdaptiveSweep Sweep (Parameters, Opts.MaxTime);
+        Sweep.SetThreadCount (Opts.ThreadCount);
+        Sweep.SetDomain (Opts.RefineAngles [0], Opts.RefineAngles [1], Opts.RefineSpeeds [0], Opts.RefineSpeeds [1]);
+        Sweep.SetLevels (Opts.FirstLevel, Opts.RefineLevel);
+
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        Sweep.Run ();
+
+        double Elapsed = ElapsedSince (Beginning);
+
+        const std::vector <CAdaptiveSweep::Cell> &Leaves = Sweep.GetLeaves ();
+        unsigned long long Boundaries = 0;
+        for (unsigned i = 0; i < Leaves.size (); ++i)
+            if (Leaves [i].Boundary)
+                ++Boundaries;
+
+        // A uniform grid of the same resolution runs every corner of the lattice.
+        unsigned long long Uniform = (unsigned long long) (Sweep.GetResolution () + 1) * (Sweep.GetResolution () + 1);
+
+        cout << "Cellules par cote : " << Sweep.GetResolution () << endl
+             << "Executions : " << Sweep.GetRunCount () << endl
+             << "Executions d'une grille uniforme : " << Uniform << endl
+             << "Gain : " << (double) Uniform / Sweep.GetRunCount () << endl
+             << "Feuilles : " << Leaves.size () << endl
+             << "Feuilles sur une frontiere : " << Boundaries << endl
+             << "Temps de calcul (s) : " << Elapsed << endl;
+
+        /* LEAVES OF THE QUADTREE */
+        if (! Opts.TreeFile.empty ())
+        {
+            ofstream Tree (Opts.TreeFile.c_str ());
+            if (! Tree)
+            {
+                cout << "Erreur: impossible d'ecrire l'arbre dans " << Opts.TreeFile << endl;
+                return -1;
+            }
+
+            // The outcome of a leaf is the one of its corner of lowest angle and speed.
+            Tree << "# angle_min angle_max vitesse_min vitesse_max taille frontiere rebonds premier_mur" << endl;
+            for (unsigned i = 0; i < Leaves.size (); ++i)
+            {
+                const CAdaptiveSweep::Cell &Leaf = Leaves [i];
+                const CSweep::Result &Corner = Sweep.GetResult (Leaf.X, Leaf.Y);
+                Tree << Sweep.GetAngle (Leaf.X) * 180 / PI << ' ' << Sweep.GetAngle (Leaf.X + Leaf.Size) * 180 / PI << ' '
+                     << Sweep.GetSpeed (Leaf.Y) << ' ' << Sweep.GetSpeed (Leaf.Y + Leaf.Size) << ' ' << Leaf.Size << ' '
+                     << Leaf.Boundary << ' ' << Corner.Bounces << ' ' << Corner.FirstImpact << '\n';
+            }
+        }
+
+        /* BOUNDARY MAP */
+        if (! Opts.BoundaryFile.empty ())
+        {
+            ofstream Boundary (Opts.BoundaryFile.c_str ());
+            if (! Boundary)
+            {
+                cout << "Erreur: impossible d'ecrire les frontieres dans " << Opts.BoundaryFile << endl;
+                return -1;
+            }
+
+            Boundary << "# angle vitesse" << endl;
+            for (unsigned i = 0; i < Leaves.size (); ++i)
+                if (Leaves [i].Boundary)
+                    Boundary << (Sweep.GetAngle (Leaves [i].X) + Sweep.GetAngle (Leaves [i].X + 1)) * 90 / PI << ' '
+                             << (Sweep.GetSpeed (Leaves [i].Y) + Sweep.GetSpeed (Leaves [i].Y + 1)) / 2 << '\n';
+        }
+
+        return 0;
+
+    }// RunAdaptiveSweep ()
+
+    // Run every combination of the swept settings and sum up the results.
+    int RunSweep (const Settings &Parameters, const Options &Opts)
+    {
+        CSweep Sweep (Parameters, Opts.MaxTime);
+        Sweep.SetThreadCount (Opts.ThreadCount);
+
+        for (unsigned i = 0; i < CSweep::FIELD_COUNT; ++i)
+            if (! Opts.Sweep [i].empty ())
+                Sweep.SetValues ((CSweep::Field) i, Opts.Sweep [i]);
+
+        // The closed form needs a gravity not negative, and bounces losing energy not to follow the roof bounces forever.
+        std::vector <float> Gravities = Opts.Sweep [CSweep::GRAVITY].empty () ? std::vector <float> (1, Parameters.Gravity) : Opts.Sweep [CSweep::GRAVITY];
+        std::vector <float> Coefs = Opts.Sweep [CSweep::RESTITUTION_COEF].empty () ? std::vector <float> (1, Parameters.RestitutionCoef) : Opts.Sweep [CSweep::RESTITUTION_COEF];
+
+        if (*min_element (Gravities.begin (), Gravities.end ()) < 0 || *min_element (Coefs.begin (), Coefs.end ()) < 0 || *max_element (Coefs.begin (), Coefs.end ()) >= 1)
+        {
+            cout << "Erreur: le balayage demande une gravite positive ou nulle et des coefficients entre 0 et 1 (exclu)." << endl;
+            return -1;
+        }
+
+        // The results are only kept to be written in the table.
+        std::vector <CSweep::Result> Results;
+        CSweep::Summary Total;
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        Sweep.Summarize (Total, Opts.BinCount, Opts.TableFile.empty () ? 0 : &Results);
+
+        double Elapsed = ElapsedSince (Beginning);
+
+        /* SUMMARY */
+        // The balls still bouncing at the end are not counted in the times to rest.
+        cout << "Executions : " << Total.Runs << endl
+             << "Temps simule par execution : " << Opts.MaxTime << endl
+             << "Rebonds moyens : " << Total.Bounces.GetMean () << endl
+             << "Balles posees avant la fin : " << Total.RestTime.GetCount () << endl
+             << "Temps moyen avant de se poser : " << Total.RestTime.GetMean () << endl
+             << "Abscisses finales : " << Total.FinalX.GetMin () << " a " << Total.FinalX.GetMax () << endl
+             << "Hauteur max : " << Total.MaxHeight.GetMax () << endl
+             << "Temps de calcul (s) : " << Elapsed << endl;
+
+        if (Elapsed > 0)
+            cout << "Executions par seconde : " << Total.Runs / Elapsed << endl;
+
+        DisplayOutcome ("Rebonds", Total.Bounces);
+        DisplayOutcome ("Temps avant de se poser (s)", Total.RestTime);
+        DisplayOutcome ("Abscisses finales (m)", Total.FinalX);
+        DisplayOutcome ("Hauteurs max (m)", Total.MaxHeight);
+
+        /* TABLE OF THE RESULTS */
+        if (! Opts.TableFile.empty ())
+        {
+            ofstream Table (Opts.TableFile.c_str ());
+            if (! Table)
+            {
+                cout << "Erreur: impossible d'ecrire le tableau dans " << Opts.TableFile << endl;
+                return -1;
+            }
+
+            Table << "# vitesse angle position gravite coef rebonds temps_pose x_final hauteur_max premier_mur" << endl;
+            for (unsigned long long i = 0; i < Results.size (); ++i)
+            {
+                Settings Run = Sweep.GetSettings (i);
+                Table << Run.Speed << ' ' << Run.Angle * 180 / PI << ' ' << Run.InitPos << ' ' << Run.Gravity << ' ' << Run.RestitutionCoef << ' '
+                      << Results [i].Bounces << ' ' << Results [i].RestTime << ' ' << Results [i].FinalX << ' ' << Results [i].MaxHeight << ' ' << Results [i].FirstImpact << '\n';
+            }
+        }
+
+        return 0;
+
+    }// RunSweep ()
+
+    // Step a single ball.
+    int RunSimulation (const Settings &Parameters, const Options &Opts, const CSegmentTree &Segments, const CTerrain *Terrain)
+    {
+        CSimulation Simulation (Parameters);
+        Simulation.SetSegments (&Segments);
+        Simulation.SetTerrain (Terrain);
+
+        CIntegrator Integrator (Opts.Method);
+        Integrator.SetDrag (Opts.LinearDrag, Opts.QuadraticDrag);
+        Integrator.SetTolerance (Opts.Tolerance);
+        Simulation.SetIntegrator (Opts.Integrating ? &Integrator : 0);
+
+        unsigned long Steps = 0;
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        while (! Simulation.IsStopped () && Simulation.GetSettings ().TotalTime < Opts.MaxTime && (Opts.MaxSteps == 0 || Steps < Opts.MaxSteps))
+        {
+            Simulation.Step (Opts.TimeStep);
+            ++Steps;
+        }
+
+        double Elapsed = ElapsedSince (Beginning);
+        pair <float, float> New = Simulation.GetNewPosition ();
+
+        cout << "Pas : " << Steps << endl
+             << "Integrateur : " << (Opts.Integrating ? CIntegrator::GetMethodName (Opts.Method) : "parabole exacte") << endl
+             << "Segments : " << Segments.GetSegmentCount () << endl
+             << "Temps simule : " << Simulation.GetSettings ().TotalTime << endl
+             << "Rebonds : " << Simulation.GetBounceCount () << endl
+             << "Coordonnees : " << New.first << ", " << New.second << endl
+             << "Vitesse : " << Simulation.GetSettings ().Speed << endl
+             << "Temps de calcul (s) : " << Elapsed << endl;
+
+        if (Elapsed > 0)
+            cout << "Pas par seconde : " << Steps / Elapsed << endl;
+
+        return 0;
+
+    }// RunSimulation ()
+
+    // Jump from one bounce to the next one.
+    int RunEventSimulation (const Settings &Parameters, const Options &Opts)
+    {
+        CEventSimulation Simulation (Parameters);
+
+        unsigned long Events = 0;
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        while (! Simulation.IsStopped () && (Opts.MaxSteps == 0 || Events < Opts.MaxSteps))
+        {
+            // Stop at the maximum time if the next impact is after.
+            double Next = Simulation.GetNextEventTime ();
+            if (Next < 0 || Next > Opts.MaxTime)
+            {
+                Simulation.AdvanceTo (Opts.MaxTime);
+                break;
+            }
+
+            Simulation.NextEvent ();
+            ++Events;
+        }
+
+        double Elapsed = ElapsedSince (Beginning);
+        pair <float, float> Position = Simulation.GetPosition ();
+        pair <float, float> Velocity = Simulation.GetVelocity ();
+
+        cout << "Evenements : " << Events << endl
+             << "Temps simule : " << Simulation.GetTime () << endl
+             << "Rebonds : " << Simulation.GetBounceCount () << endl
+             << "Coordonnees : " << Position.first << ", " << Position.second << endl
+             << "Vitesse sur l'axe X : " << Velocity.first << endl
+             << "Vitesse sur l'axe Y : " << Velocity.second << endl
+             << "Temps de calcul (s) : " << Elapsed << endl;
+
+        return 0;
+
+    }// RunEventSimulation ()
+
+    // Query the closed form of the trajectory at several times and compare it with the event driven engine.
+    int RunTrajectory (const Settings &Parameters, const Options &Opts)
+    {
+        // The closed form needs a gravity not negative, and bounces not giving energy to the ball.
+        if (Parameters.Gravity < 0 || Parameters.RestitutionCoef < 0 || Parameters.RestitutionCoef > 1)
+        {
+            cout << "Erreur: --at demande une gravite positive ou nulle et un coefficient entre 0 et 1." << endl;
+            return -1;
+        }
+
+        std::vector <double> Times (Opts.Queries);
+        std::vector <BallState> States (Opts.Queries);
+
+        for (unsigned i = 0; i < Opts.Queries; ++i)
+            Times [i] = Opts.Queries > 1 ? (double) Opts.MaxTime * i / (Opts.Queries - 1) : Opts.MaxTime;
+
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        CTrajectory Trajectory (Parameters);
+        Trajectory.GetStates (Times.data (), States.data (), Opts.Queries);
+
+        double Elapsed = ElapsedSince (Beginning);
+
+        // The event driven engine goes through every bounce, the times are sorted.
+        CEventSimulation Simulation (Parameters);
+        double PositionError = 0;
+        unsigned BounceMismatch = 0;
+
+        for (unsigned i = 0; i < Opts.Queries; ++i)
+        {
+            Simulation.AdvanceTo (Times [i]);
+            pair <float, float> Position = Simulation.GetPosition ();
+
+            double DX = Position.first - States [i].X;
+            double DY = Position.second - States [i].Y;
+            PositionError = max (PositionError, sqrt (DX * DX + DY * DY));
+
+            if (Simulation.GetBounceCount () != States [i].Bounces)
+                ++BounceMismatch;
+        }
+
+        const BallState &Last = States.back ();
+
+        cout << "Instants : " << Opts.Queries << endl
+             << "Temps : " << Times.back () << endl
+             << "Rebonds : " << Last.Bounces << endl
+             << "Coordonnees : " << Last.X << ", " << Last.Y << endl
+             << "Vitesse sur l'axe X : " << Last.VelX << endl
+             << "Vitesse sur l'axe Y : " << Last.VelY << endl
+             << "Fin des rebonds sur le sol (s) : " << Trajectory.GetRestTime () << endl
+             << "Arret de la balle (s) : " << Trajectory.GetStopTime () << endl
+             << "Ecart max de position avec --events : " << PositionError << endl
+             << "Instants avec un nombre de rebonds different : " << BounceMismatch << " / " << Opts.Queries << endl
+             << "Temps de calcul (s) : " << Elapsed << endl;
+
+        if (Elapsed > 0)
+            cout << "Instants par seconde : " << Opts.Queries / Elapsed << endl;
+
+        return 0;
+
+    }// RunTrajectory ()
+
+    // Report the error and the speed of every math precision.
+    int RunMathReport (const Settings &Parameters, const Options &Opts)
+    {
+        const MathPrecision Precisions [3] = {MATH_EXACT, MATH_FAST6, MATH_FAST4};
+        const unsigned Samples = 100000;
+        const unsigned Launches = 1000;
+
+        // Trajectories of reference, computed with the exact functions : launch angles from 1 to 89 degrees.
+        std::vector <pair <float, float> > Reference (Launches);
+        std::vector <unsigned> ReferenceBounces (Launches);
+
+        for (unsigned Precision = 0; Precision < 3; ++Precision)
+        {
+            SetMathPrecision (Precisions [Precision]);
+
+            /* ERROR OF THE FUNCTIONS */
+            double SinCosError = 0;
+            double AcosError = 0;
+
+            for (unsigned i = 0; i <= Samples; ++i)
+            {
+                float X = -2 * PI + 4 * PI * i / Samples;
+                float Sin;
+                float Cos;
+                FastSinCos (X, Sin, Cos);
+
+                SinCosError = max (SinCosError, fabs (Sin - sin ((double) X)));
+                SinCosError = max (SinCosError, fabs (Cos - cos ((double) X)));
+
+                float C = -1 + 2.0 * i / Samples;
+                double Acos = acos ((double) C);
+                if (Acos > 0)
+                    AcosError = max (AcosError, fabs (FastAcos (C) - Acos) / Acos);
+            }
+
+            /* SPEED OF THE FUNCTIONS */
+            float Sum = 0;
+            chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+            for (unsigned i = 0; i < 100 * Samples; ++i)
+            {
+                float Sin;
+                float Cos;
+                FastSinCos (i * 1e-4f, Sin, Cos);
+                Sum += Sin + Cos + FastAcos (Sin);
+            }
+
+            double FunctionTime = ElapsedSince (Beginning) / (100.0 * Samples) * 1e9;
+
+            // Keep the loop from being removed by the compiler.
+            volatile float Sink = Sum;
+            (void) Sink;
+
+            /* ERROR OF THE TRAJECTORIES */
+            double PositionError = 0;
+            unsigned BounceMismatch = 0;
+
+            for (unsigned i = 0; i < Launches; ++i)
+            {
+                Settings Launch = Parameters;
+                Launch.Angle = (1 + 88.0 * i / (Launches - 1)) * (float) PI / 180.0;
+
+                CEventSimulation Simulation (Launch);
+                Simulation.AdvanceTo (Opts.MaxTime);
+
+                pair <float, float> Position = Simulation.GetPosition ();
+
+                if (Precisions [Precision] == MATH_EXACT)
+                {
+                    Reference [i] = Position;
+                    ReferenceBounces [i] = Simulation.GetBounceCount ();
+                    continue;
+                }
+
+                double DX = Position.first - Reference [i].first;
+                double DY = Position.second - Reference [i].second;
+                PositionError = max (PositionError, sqrt (DX * DX + DY * DY));
+
+                if (Simulation.GetBounceCount () != ReferenceBounces [i])
+                    ++BounceMismatch;
+            }
+
+            cout << "Precision " << GetMathPrecisionName (Precisions [Precision]) << " :" << endl
+                 << "  erreur absolue max sin/cos : " << SinCosError << endl
+                 << "  erreur relative max acos : " << AcosError << endl
+                 << "  temps par appel sincos + acos (ns) : " << FunctionTime << endl
+                 << "  ecart max de position a t = " << Opts.MaxTime << " s : " << PositionError << endl
+                 << "  trajectoires avec un nombre de rebonds different : " << BounceMismatch << " / " << Launches << endl;
+        }
+
+        SetMathPrecision (MATH_DEFAULT_PRECISION);
+
+        return 0;
+
+    }// RunMathReport ()
+
+    // Integrate a free flight of FlightTime seconds without walls, in steps of TimeStep. Return the number of steps.
+    unsigned long Fly (CIntegrator &Integrator, const Settings &Parameters, double TimeStep, double &X, double &Y)
+    {
+        float Sin;
+        float Cos;
+        FastSinCos (Parameters.Angle, Sin, Cos);
+
+        X = 0;
+        Y = Parameters.InitPos;
+        double VelX = Parameters.Speed * Cos;
+        double VelY = Parameters.Speed * Sin;
+
+        unsigned long Steps = (unsigned long) (FlightTime / TimeStep + 0.5);
+        for (unsigned long i = 0; i < Steps; ++i)
+            Integrator.Step (X, Y, VelX, VelY, Parameters.Gravity, TimeStep);
+
+        return Steps;
+
+    }// Fly ()
+
+    // Report the error and the speed of every integrator, and the cheapest one meeting the budget.
+    int RunIntegratorReport (const Settings &Parameters, const Options &Opts)
+    {
+        const CIntegrator::Method Methods [4] = {CIntegrator::EULER, CIntegrator::VERLET, CIntegrator::RK4, CIntegrator::RK45};
+        const double TimeSteps [6] = {0.04, 0.02, 0.01, 0.005, 0.0025, 0.00125};
+
+        double LinearDrag = Opts.LinearDrag;
+        double QuadraticDrag = Opts.QuadraticDrag;
+        if (LinearDrag == 0 && QuadraticDrag == 0)
+        {
+            LinearDrag = ReportLinearDrag;
+            QuadraticDrag = ReportQuadraticDrag;
+        }
+
+        /* REFERENCES */
+        // Without drag the closed form of the parabola.
+        Settings Flight = Parameters;
+        Flight.Time = FlightTime;
+        Flight.Dir = LEFTTORIGHT;
+        pair <float, float> Parabola = PositionComputing (Flight, 0);
+
+        // With drag the adaptive integrator far under the budget.
+        CIntegrator Reference (CIntegrator::RK45);
+        Reference.SetDrag (LinearDrag, QuadraticDrag);
+        Reference.SetTolerance (1e-13);
+        double ReferenceX;
+        double ReferenceY;
+        Fly (Reference, Parameters, TimeSteps [5] / 8, ReferenceX, ReferenceY);
+
+        cout << "Vol de " << FlightTime << " s, frottement lineaire " << LinearDrag << " /s, quadratique " << QuadraticDrag << " /m" << endl
+             << "Ecart sans frottement : avec PositionComputing, en float" << endl
+             << "Budget : " << Opts.Budget << " m, sur l'ecart avec frottement" << endl;
+
+        bool Found = false;
+        CIntegrator::Method Cheapest = CIntegrator::EULER;
+        double CheapestStep = 0;
+        double CheapestSpeed = 0;
+
+        for (unsigned Method = 0; Method < 4; ++Method)
+        {
+            cout << "Integrateur " << CIntegrator::GetMethodName (Methods [Method]) << " :" << endl;
+
+            for (unsigned Step = 0; Step < 6; ++Step)
+            {
+                double TimeStep = TimeSteps [Step];
+
+                // The adaptive integrator spreads the budget over the steps of the flight.
+                double Tolerance = Opts.Budget * TimeStep / FlightTime;
+
+                /* ERROR WITHOUT DRAG, AGAINST THE PARABOLA */
+                CIntegrator Integrator (Methods [Method]);
+                Integrator.SetTolerance (Tolerance);
+                double X;
+                double Y;
+                Fly (Integrator, Parameters, TimeStep, X, Y);
+                double FreeError = sqrt ((X - Parabola.first) * (X - Parabola.first) + (Y - Parabola.second) * (Y - Parabola.second));
+
+                /* ERROR WITH DRAG, AGAINST THE REFERENCE */
+                Integrator.SetMethod (Methods [Method]);
+                Integrator.SetDrag (LinearDrag, QuadraticDrag);
+                Fly (Integrator, Parameters, TimeStep, X, Y);
+                double DragError = sqrt ((X - ReferenceX) * (X - ReferenceX) + (Y - ReferenceY) * (Y - ReferenceY));
+
+                /* SPEED WITH DRAG */
+                unsigned long Steps = 0;
+                double Elapsed = 0;
+                chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+                while (Elapsed < 0.05)
+                {
+                    Integrator.SetMethod (Methods [Method]);
+                    Steps += Fly (Integrator, Parameters, TimeStep, X, Y);
+                    Elapsed = ElapsedSince (Beginning);
+                }
+
+                // Keep the flights from being removed by the compiler.
+                volatile double Sink = X + Y;
+                (void) Sink;
+
+                double StepSpeed = Steps / Elapsed;
+
+                cout << "  pas " << TimeStep << " s : ecart sans frottement " << FreeError << ", avec frottement " << DragError
+                     << ", pas par seconde " << StepSpeed << endl;
+
+                // The cheapest one simulates the most seconds per second of computing. The parabola in float does not bound the budget.
+                if (DragError <= Opts.Budget && StepSpeed * TimeStep > CheapestSpeed)
+                {
+                    Found = true;
+                    Cheapest = Methods [Method];
+                    CheapestStep = TimeStep;
+                    CheapestSpeed = StepSpeed * TimeStep;
+                }
+            }
+        }
+
+        if (Found)
+            cout << "Le moins cher sous le budget : " << CIntegrator::GetMethodName (Cheapest) << ", pas " << CheapestStep
+                 << " s (" << CheapestSpeed << " s simulees par seconde)" << endl;
+        else
+            cout << "Aucun integrateur ne tient le budget." << endl;
+
+        return 0;
+
+    }// RunIntegratorReport ()
+
+    // Drop balls through a field of pegs and count where they land.
+    int RunPegBoard (const Settings &Parameters, const Options &Opts, const CPegBoard &Board)
+    {
+        float Sin;
+        float Cos;
+        FastSinCos (Parameters.Angle, Sin, Cos);
+
+        // One bin per meter of the floor.
+        std::vector <unsigned long> Bins (ARENA_WIDTH + 1, 0);
+        unsigned long Held = 0;
+        unsigned long Bounces = 0;
+
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        // The balls are spread regularly over the band, the pegs scatter them.
+        for (unsigned long i = 0; i < Opts.Drops; ++i)
+        {
+            double X = ARENA_WIDTH / 2.0 + DropWidth * ((i + 0.5) / Opts.Drops - 0.5);
+            double LandingX;
+            unsigned DropBounces;
+
+            if (! Board.Drop (X, Parameters.InitPos, Parameters.Speed * Cos, Parameters.Speed * Sin, Parameters.Gravity,
+                              Parameters.RestitutionCoef, LandingX, DropBounces))
+            {
+                ++Held;
+                continue;
+            }
+
+            Bounces += DropBounces;
+            ++Bins [min ((unsigned) LandingX, (unsigned) ARENA_WIDTH)];
+        }
+
+        double Elapsed = ElapsedSince (Beginning);
+
+        cout << "Clous : " << Board.GetPegCount () << endl
+             << "Lachers : " << Opts.Drops << endl
+             << "Balles retenues : " << Held << endl
+             << "Rebonds par balle : " << (Opts.Drops > Held ? (double) Bounces / (Opts.Drops - Held) : 0) << endl
+             << "Temps de calcul (s) : " << Elapsed << endl;
+
+        if (Elapsed > 0)
+            cout << "Lachers par seconde : " << Opts.Drops / Elapsed << endl;
+
+        cout << "Points de chute (m : balles) :" << endl;
+        for (unsigned i = 0; i < Bins.size (); ++i)
+            if (Bins [i] > 0)
+                cout << "  " << i << " : " << Bins [i] << endl;
+
+        return 0;
+
+    }// RunPegBoard ()
+
+    // Give the launch parameters and the abscissa of each ball of a world, return false if they do not fit in the arena.
+    bool PlaceBalls (const Settings &Parameters, const Options &Opts, std::vector <Settings> &Launches, std::vector <float> &Abscissas)
+    {
+        // Balls with a radius are put side by side, row after row from the initial position.
+        float Spacing = 2.5f * Opts.Radius;
+        unsigned Columns = Spacing > 0 ? (unsigned) (ARENA_WIDTH / Spacing) : 1;
+
+        if (Spacing > 0 && (Columns == 0 || Parameters.InitPos + (Opts.BallNumber - 1) / Columns * Spacing > ARENA_HEIGHT))
+        {
+            cout << "Erreur: trop de balles pour ce rayon." << endl;
+            return false;
+        }
+
+        Launches.assign (Opts.BallNumber, Parameters);
+        Abscissas.assign (Opts.BallNumber, 0);
+
+        // Spread the launch angles between Angle and Angle + Spread.
+        for (unsigned i = 0; i < Opts.BallNumber; ++i)
+        {
+            if (Opts.BallNumber > 1)
+                Launches [i].Angle += Opts.Spread * i / (Opts.BallNumber - 1);
+
+            if (Spacing > 0)
+            {
+                Abscissas [i] = (i % Columns + 0.5f) * Spacing;
+                Launches [i].InitPos += i / Columns * Spacing;
+            }
+        }
+
+        return true;
+
+    }// PlaceBalls ()
+
+    // Process the events of a world of hard balls in time order.
+    int RunEventWorld (const Settings &Parameters, const Options &Opts)
+    {
+        std::vector <Settings> Launches;
+        std::vector <float> Abscissas;
+        if (! PlaceBalls (Parameters, Opts, Launches, Abscissas))
+            return -1;
+
+        CEventWorld World (Opts.Radius);
+        World.Reserve (Opts.BallNumber);
+        for (unsigned i = 0; i < Opts.BallNumber; ++i)
+            World.AddBall (Launches [i], Abscissas [i]);
+
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        // The number of events is bounded like the number of steps, a dense pile of inelastic balls makes them pile up.
+        if (Opts.MaxSteps == 0)
+            World.AdvanceTo (Opts.MaxTime);
+        else
+            while (World.GetEventCount () < Opts.MaxSteps && World.NextEvent (Opts.MaxTime) >= 0)
+                ;
+
+        double Elapsed = ElapsedSince (Beginning);
+
+        unsigned long Bounces = 0;
+        for (unsigned i = 0; i < Opts.BallNumber; ++i)
+            Bounces += World.GetBounceCount (i);
+
+        cout << "Balles : " << Opts.BallNumber << endl
+             << "Evenements : " << World.GetEventCount () << endl
+             << "Evenements perimes : " << World.GetStaleEventCount () << endl
+             << "Temps simule : " << World.GetTime () << endl
+             << "Rebonds : " << Bounces << endl
+             << "Chocs entre balles : " << World.GetCollisionCount () << endl
+             << "Temps de calcul (s) : " << Elapsed << endl;
+
+        if (Elapsed > 0)
+            cout << "Evenements par seconde : " << World.GetEventCount () / Elapsed << endl;
+
+        return 0;
+
+    }// RunEventWorld ()
+
+    // Step a world of balls.
+    int RunWorld (const Settings &Parameters, const Options &Opts, const CSegmentTree &Segments, const CTerrain *Terrain, const CForceField *Field)
+    {
+        if (Opts.BallNumber > WORLD_MAX_BALLS)
+        {
+            cout << "Erreur: un monde contient au plus " << WORLD_MAX_BALLS << " balles." << endl;
+            return -1;
+        }
+
+        std::vector <Settings> Launches;
+        std::vector <float> Abscissas;
+        if (! PlaceBalls (Parameters, Opts, Launches, Abscissas))
+            return -1;
+
+        // The balls of a chain are placed apart by their radius, they are all launched at once.
+        if (Opts.ChainLength > 1 && (Opts.Radius <= 0 || Opts.EmitRate > 0))
+        {
+            cout << "Erreur: les chaines demandent un rayon (--radius), sans --emit." << endl;
+            return -1;
+        }
+
+        // The chunks of balls and the grid are spread over the threads of the job system.
+        CJobSystem Jobs (Opts.ThreadCount);
+        CWorld World;
+        World.SetJobSystem (&Jobs);
+        World.Reserve (Opts.BallNumber);
+        World.SetRadius (Opts.Radius);
+        World.SetSolverIterations (Opts.Iterations);
+        World.SetThreadCount (Opts.ThreadCount);
+        World.SetSegments (&Segments);
+        World.SetTerrain (Terrain);
+        World.SetForceField (Field);
+
+        // Without an emitter every ball is launched at once.
+        bool Emitter = Opts.EmitRate > 0;
+        if (! Emitter)
+            for (unsigned i = 0; i < Opts.BallNumber; ++i)
+                World.AddBall (Launches [i], Abscissas [i]);
+
+        // The chains link each ball to the next one of its row, the first balls added have their indexes as handles.
+        if (! Emitter && Opts.ChainLength > 1)
+            for (unsigned i = 0; i + 1 < Opts.BallNumber; ++i)
+                if ((i + 1) % Opts.ChainLength != 0 && Launches [i + 1].InitPos == Launches [i].InitPos)
+                    World.AddLink (i, i + 1, Opts.Stiffness);
+
+        unsigned long Steps = 0;
+        unsigned long Launched = 0;
+        unsigned long Removed = 0;
+        unsigned long Bounces = 0;
+        unsigned long long BallSteps = 0;
+
+        // Handles and launch times of the balls present, oldest first, in a ring as large as the world.
+        std::vector <unsigned> Handles (Emitter ? Opts.BallNumber : 0);
+        std::vector <float> Births (Handles.size ());
+        unsigned Oldest = 0;
+
+        chrono::steady_clock::time_point Beginning = chrono::steady_clock::now ();
+
+        while (World.GetTotalTime () < Opts.MaxTime && (Opts.MaxSteps == 0 || Steps < Opts.MaxSteps))
+        {
+            if (Emitter)
+            {
+                // The balls that lived long enough leave the world, they give their places to the next ones.
+                while (World.GetBallCount () > 0 && World.GetTotalTime () - Births [Oldest] >= Opts.LifeTime)
+                {
+                    Bounces += World.GetBounceCount (Handles [Oldest]);
+                    World.RemoveBall (Handles [Oldest]);
+                    Oldest = (Oldest + 1) % Opts.BallNumber;
+                    ++Removed;
+                }
+
+                // The balls due since the beginning are launched in turn from the places of the balls of the world, while there is room.
+                while (Launched < World.GetTotalTime () * Opts.EmitRate && World.GetBallCount () < Opts.BallNumber)
+                {
+                    unsigned i = Launched % Opts.BallNumber;
+                    unsigned Newest = (Oldest + World.GetBallCount ()) % Opts.BallNumber;
+                    Handles [Newest] = World.AddBall (Launches [i], Abscissas [i]);
+                    if (Handles [Newest] == WORLD_NO_BALL)
+                    {
+                        cout << "Erreur: plus aucun indice de balle libre apres " << Launched << " lancers." << endl;
+                        return -1;
+                    }
+                    Births [Newest] = World.GetTotalTime ();
+                    ++Launched;
+                }
+            }
+
+            BallSteps += World.GetBallCount ();
+            World.Step (Opts.TimeStep);
+            ++Steps;
+        }
+
+        double Elapsed = ElapsedSince (Beginning);
+
+        for (unsigned Slot = 0; Slot < World.GetBallCount (); ++Slot)
+            Bounces += World.GetBounceCount (World.GetBallAt (Slot));
+
+        cout << "Balles : " << Opts.BallNumber << endl
+             << "Jeu d'instructions : " << GetSimdLevelName (GetSimdLevel ()) << endl
+             << "Pas : " << Steps << endl
+             << "Segments : " << Segments.GetSegmentCount () << endl
+             << "Champ de forces : " << (Field != 0 ? Field->GetColumnCount () : 0) << " x " << (Field != 0 ? Field->GetRowCount () : 0) << endl
+             << "Temps simule : " << World.GetTotalTime () << endl
+             << "Rebonds : " << Bounces << endl
+             << "Balles endormies : " << World.GetBallCount () - World.GetActiveCount () << endl
+             << "Chocs entre balles : " << World.GetCollisionCount () << endl;
+
+        if (Emitter)
+            cout << "Balles lancees : " << Launched << endl
+                 << "Balles retirees : " << Removed << endl;
+
+        if (World.GetLinkCount () > 0)
+            cout << "Liens : " << World.GetLinkCount () << endl
+                 << "Couleurs des liens : " << World.GetLinkColourCount () << endl;
+
+        if (Opts.Iterations > 0)
+            cout << "Contacts : " << World.GetContactCount () << endl
+                 << "Iles : " << World.GetIslandCount () << endl;
+
+        cout << "Temps de calcul (s) : " << Elapsed << endl;
+
+        if (Elapsed > 0)
+            cout << "Balles x pas par seconde : " << BallSteps / Elapsed << endl;
+
+        return 0;
+
+    }// RunWorld ()
+
+    // Display the result of a check, return true if it passed.
+    bool Check (bool Passed, const string &Name)
+    {
+        if (Passed)
+            cout << "OK : " << Name << endl;
+        else
+            cout << "Erreur: " << Name << endl;
+
+        return Passed;
+
+    }// Check ()
+
+    // Check the behaviours the engines must keep on the scenario of Parameters, return 0 if every check passed.
+    int RunChecks (const Settings &Parameters, float TimeStep)
+    {
+        // Longest run of an engine.
+        const float MaxTime = 600;
+        unsigned Failures = 0;
+
+        /* A BALL OF THE WORLD SLIDING ON THE FLOOR IS STOPPED BY THE FRICTION */
+        {
+            const float SleepTime = 120;
+            CWorld World;
+            unsigned Ball = World.AddBall (Parameters);
+            while (World.GetTotalTime () < SleepTime && ! World.IsSleeping (Ball))
+                World.Step (TimeStep);
+
+            if (! Check (World.IsSleeping (Ball), "balle du monde endormie avant 120 s"))
+                ++Failures;
+        }
+
+        /* EVERY ENGINE STOPS THE BALL AT THE SAME PLACE AFTER THE SAME BOUNCES */
+        {
+            // The exact engines agree to rounding, the stepped ones put the ball to rest on the floor at the end of a step.
+            const float ExactError = 1e-3;
+            const float SteppedError = 0.5;
+
+            CEventSimulation Events (Parameters);
+            while (Events.NextEvent () >= 0)
+                ;
+            float EventX = Events.GetPosition ().first;
+            unsigned EventBounces = Events.GetBounceCount ();
+
+            CTrajectory Trajectory (Parameters);
+            BallState Last = Trajectory.GetState (Trajectory.GetStopTime ());
+
+            CSimulation Simulation (Parameters);
+            while (! Simulation.IsStopped () && Simulation.GetSettings ().TotalTime < MaxTime)
+                Simulation.Step (TimeStep);
+
+            CWorld World;
+            unsigned Ball = World.AddBall (Parameters);
+            while (! World.IsSleeping (Ball) && World.GetTotalTime () < MaxTime)
+                World.Step (TimeStep);
+
+            CEventWorld EventWorld (0);
+            EventWorld.AddBall (Parameters);
+            EventWorld.AdvanceTo (MaxTime);
+
+            if (! Check (Events.IsStopped () && Last.Bounces == EventBounces && fabs (Last.X - EventX) < ExactError,
+                         "fermeture de CTrajectory egale a --events"))
+                ++Failures;
+            if (! Check (Simulation.IsStopped () && Simulation.GetBounceCount () == EventBounces
+                         && fabs (Simulation.GetNewPosition ().first - EventX) < SteppedError, "CSimulation proche de --events"))
+                ++Failures;
+            if (! Check (World.IsSleeping (Ball) && World.GetBounceCount (Ball) == EventBounces
+                         && fabs (World.GetPosition (Ball).first - EventX) < SteppedError, "CWorld proche de --events"))
+                ++Failures;
+            if (! Check (EventWorld.GetBounceCount (0) == EventBounces && fabs (EventWorld.GetPosition (0).first - EventX) < ExactError,
+                         "CEventWorld egal a --events"))
+                ++Failures;
+        }
+
+        /* THE HANDLE OF A REMOVED BALL IS REFUSED, EVEN ONCE ITS INDEX IS REUSED */
+        {
+            CWorld World;
+            unsigned Removed = World.AddBall (Parameters);
+            unsigned Other = World.AddBall (Parameters);
+            for (unsigned i = 0; i < 100; ++i)
+                World.Step (TimeStep);
+            World.RemoveBall (Removed);
+
+            bool Refused = ! World.IsAlive (Removed) && ! World.RemoveBall (Removed) && ! World.Wake (Removed)
+                           && ! World.SetVelocity (Removed, 1, 1) && ! World.SetGravity (Removed, 1) && ! World.SetRestitutionCoef (Removed, 1)
+                           && World.GetBounceCount (Removed) == 0 && World.GetSpeed (Removed) == 0 && World.GetPosition (Removed).first == 0
+                           && ! World.IsResting (Removed) && ! World.IsSleeping (Removed) && World.AddLink (Removed, Other) == WORLD_NO_LINK
+                           && World.AddAnchor (Removed, 0, 0) == WORLD_NO_LINK;
+            if (! Check (Refused, "poignee d'une balle retiree refusee"))
+                ++Failures;
+
+            // The new ball takes the index of the removed one, with another generation.
+            unsigned Reused = World.AddBall (Parameters);
+            World.SetVelocity (Reused, 5, 0);
+            bool Kept = (Reused & WORLD_INDEX_MASK) == (Removed & WORLD_INDEX_MASK) && Reused != Removed && ! World.IsAlive (Removed)
+                        && ! World.SetVelocity (Removed, 1, 1) && World.GetVelocity (Reused).first == 5 && World.GetBounceCount (Removed) == 0;
+            if (! Check (Kept, "poignee perimee refusee apres la reutilisation de son indice"))
+                ++Failures;
+        }
+
+        cout << "Verifications echouees : " << Failures << endl;
+
+        return Failures == 0 ? 0 : -1;
+
+    }// RunChecks ()
+}
+
+int main (int argc, char **argv)
+{
+    // Default scenario, same as the speed tests of the OpenGL scene.
+    Settings Parameters;
+    Parameters.Speed = 20;
+    Parameters.Angle = 45;
+    Parameters.InitPos = 20;
+    Parameters.Gravity = 9.81;
+    Parameters.RestitutionCoef = .85;
+    Parameters.Qual = MEDIUM;
+    Parameters.Time = 0;
+    Parameters.TotalTime = 0;
+    Parameters.Dir = LEFTTORIGHT;
+
+    Options Opts;
+    Opts.TimeStep = 1.0 / 50.0;
+    Opts.MaxTime = 600;
+    Opts.MaxSteps = 0;
+    Opts.BallNumber = 0;
+    Opts.Spread = 0;
+    Opts.Radius = 0;
+    Opts.Iterations = 0;
+    Opts.ThreadCount = 0;
+    Opts.Events = false;
+    Opts.MathReport = false;
+    Opts.Checking = false;
+    Opts.Queries = 0;
+    Opts.Drops = 10000;
+    Opts.EmitRate = 0;
+    Opts.LifeTime = 10;
+    Opts.ChainLength = 0;
+    Opts.Stiffness = 0;
+    Opts.Integrating = false;
+    Opts.Method = CIntegrator::RK4;
+    Opts.LinearDrag = 0;
+    Opts.QuadraticDrag = 0;
+    Opts.Tolerance = 1e-6;
+    Opts.IntegratorReport = false;
+    Opts.Budget = 0.001;
+    Opts.Sweeping = false;
+    Opts.Samples = 0;
+    Opts.Seed = 0;
+    Opts.BinCount = 20;
+    Opts.Progress = false;
+    Opts.RefineLevel = 0;
+    Opts.FirstLevel = 3;
+    Opts.RefineAngles [0] = 0;
+    Opts.RefineAngles [1] = PI / 2;
+    Opts.RefineSpeeds [0] = 0;
+    Opts.RefineSpeeds [1] = 40;
+    for (unsigned i = 0; i < CMonteCarlo::FIELD_COUNT; ++i)
+    {
+        Opts.Laws [i].Kind = CMonteCarlo::FIXED;
+        Opts.Laws [i].A = 0;
+        Opts.Laws [i].B = 0;
+    }
+
+    // The checks always run the default scenario, whatever the other options.
+    Settings Defaults = Parameters;
+    Defaults.Angle = Defaults.Angle * (float) PI / 180.0;
+    float DefaultTimeStep = Opts.TimeStep;
+
+    /*
+    ** ARGUMENTS PARSING
+    */
+    for (int i = 1; i < argc; ++i)
+    {
+        string Option (argv [i]);
+
+        /* OPTIONS WITHOUT VALUE */
+        if (Option == "--help" || Option == "-h")
+        {
+            Usage (argv [0]);
+            return 0;
+        }
+
+        if (Option == "--events")
+        {
+            Opts.Events = true;
+            continue;
+        }
+
+        if (Option == "--check")
+        {
+            Opts.Checking = true;
+            continue;
+        }
+
+        if (Option == "--math-report")
+        {
+            Opts.MathReport = true;
+            continue;
+        }
+
+        if (Option == "--integrator-report")
+        {
+            Opts.IntegratorReport = true;
+            continue;
+        }
+
+        if (Option == "--progress")
+        {
+            Opts.Progress = true;
+            continue;
+        }
+
+        /* OPTIONS WITH A VALUE */
+        if (i + 1 >= argc)
+        {
+            cout << "Erreur: l'option " << Option << " attend une valeur." << endl;
+            Usage (argv [0]);
+            return -1;
+        }
+
+        const char *Value = argv [++i];
+
+        if (Option == "--speed")
+            Parameters.Speed = atof (Value);
+        else if (Option == "--angle")
+            Parameters.Angle = atof (Value);
+        else if (Option == "--pos")
+            Parameters.InitPos = atof (Value);
+        else if (Option == "--gravity")
+            Parameters.Gravity = atof (Value);
+        else if (Option == "--coef")
+            Parameters.RestitutionCoef = atof (Value);
+        else if (Option == "--dt")
+            Opts.TimeStep = atof (Value);
+        else if (Option == "--time")
+            Opts.MaxTime = atof (Value);
+        else if (Option == "--steps")
+            Opts.MaxSteps = atol (Value);
+        else if (Option == "--balls")
+            Opts.BallNumber = atol (Value);
+        else if (Option == "--spread")
+            Opts.Spread = atof (Value);
+        else if (Option == "--radius")
+            Opts.Radius = atof (Value);
+        else if (Option == "--solver")
+            Opts.Iterations = atol (Value);
+        else if (Option == "--threads")
+            Opts.ThreadCount = atol (Value);
+        else if (Option == "--segments")
+            Opts.SegmentFile = Value;
+        else if (Option == "--terrain")
+            Opts.TerrainFile = Value;
+        else if (Option == "--field")
+            Opts.FieldFile = Value;
+        else if (Option == "--pegs")
+            Opts.PegFile = Value;
+        else if (Option == "--drops")
+            Opts.Drops = atol (Value);
+        else if (Option == "--emit")
+            Opts.EmitRate = atof (Value);
+        else if (Option == "--life")
+            Opts.LifeTime = atof (Value);
+        else if (Option == "--chain")
+            Opts.ChainLength = atol (Value);
+        else if (Option == "--stiffness")
+            Opts.Stiffness = atof (Value);
+        else if (Option == "--drag")
+            Opts.QuadraticDrag = atof (Value);
+        else if (Option == "--drag-linear")
+            Opts.LinearDrag = atof (Value);
+        else if (Option == "--tolerance")
+            Opts.Tolerance = atof (Value);
+        else if (Option == "--budget")
+            Opts.Budget = atof (Value);
+        else if (Option == "--table")
+            Opts.TableFile = Value;
+        else if (Option == "--mc")
+            Opts.Samples = strtoull (Value, 0, 10);
+        else if (Option == "--seed")
+            Opts.Seed = strtoull (Value, 0, 10);
+        else if (Option == "--bins")
+            Opts.BinCount = atol (Value);
+        else if (Option == "--refine")
+            Opts.RefineLevel = atol (Value);
+        else if (Option == "--refine-start")
+            Opts.FirstLevel = atol (Value);
+        else if (Option == "--tree")
+            Opts.TreeFile = Value;
+        else if (Option == "--boundary")
+            Opts.BoundaryFile = Value;
+        else if (Option == "--refine-angle" || Option == "--refine-speed")
+        {
+            // From deg to rad
+            bool Angles = Option == "--refine-angle";
+            if (! ParseRange (Value, Angles ? (float) PI / 180.0 : 1, Angles ? Opts.RefineAngles : Opts.RefineSpeeds))
+            {
+                cout << "Erreur: intervalle invalide pour " << Option << " : " << Value << endl;
+                return -1;
+            }
+        }
+        else if (Option.compare (0, 5, "--mc-") == 0)
+        {
+            string Name (Option, 5);
+            CMonteCarlo::Field Drawn;
+
+            if (Name == "speed")
+                Drawn = CMonteCarlo::SPEED;
+            else if (Name == "angle")
+                Drawn = CMonteCarlo::ANGLE;
+            else if (Name == "pos")
+                Drawn = CMonteCarlo::INIT_POS;
+            else if (Name == "gravity")
+                Drawn = CMonteCarlo::GRAVITY;
+            else if (Name == "coef")
+                Drawn = CMonteCarlo::RESTITUTION_COEF;
+            else
+            {
+                cout << "Erreur: option inconnue " << Option << endl;
+                Usage (argv [0]);
+                return -1;
+            }
+
+            // From deg to rad
+            if (! ParseDistribution (Value, Drawn == CMonteCarlo::ANGLE ? (float) PI / 180.0 : 1, Opts.Laws [Drawn]))
+            {
+                cout << "Erreur: loi invalide pour " << Option << " : " << Value << endl;
+                return -1;
+            }
+        }
+        else if (Option == "--at")
+            Opts.Queries = atol (Value);
+        else if (Option.compare (0, 8, "--sweep-") == 0)
+        {
+            string Name (Option, 8);
+            CSweep::Field Swept;
+
+            if (Name == "speed")
+                Swept = CSweep::SPEED;
+            else if (Name == "angle")
+                Swept = CSweep::ANGLE;
+            else if (Name == "pos")
+                Swept = CSweep::INIT_POS;
+            else if (Name == "gravity")
+                Swept = CSweep::GRAVITY;
+            else if (Name == "coef")
+                Swept = CSweep::RESTITUTION_COEF;
+            else
+            {
+                cout << "Erreur: option inconnue " << Option << endl;
+                Usage (argv [0]);
+                return -1;
+            }
+
+            // From deg to rad
+            if (! ParseValues (Value, Swept == CSweep::ANGLE ? (float) PI / 180.0 : 1, Opts.Sweep [Swept]))
+            {
+                cout << "Erreur: valeurs invalides pour " << Option << " : " << Value << endl;
+                return -1;
+            }
+
+            Opts.Sweeping = true;
+        }
+        else if (Option == "--integrator")
+        {
+            string Method (Value);
+            Opts.Integrating = true;
+
+            if (Method == "euler")
+                Opts.Method = CIntegrator::EULER;
+            else if (Method == "verlet")
+                Opts.Method = CIntegrator::VERLET;
+            else if (Method == "rk4")
+                Opts.Method = CIntegrator::RK4;
+            else if (Method == "rk45")
+                Opts.Method = CIntegrator::RK45;
+            else
+            {
+                cout << "Erreur: integrateur inconnu " << Method << endl;
+                return -1;
+            }
+        }
+        else if (Option == "--simd")
+        {
+            string Level (Value);
+
+            if (Level == "scalar")
+                SetSimdLevel (SIMD_SCALAR);
+            else if (Level == "sse2")
+                SetSimdLevel (SIMD_SSE2);
+            else if (Level == "avx2")
+                SetSimdLevel (SIMD_AVX2);
+            else if (Level == "avx512")
+                SetSimdLevel (SIMD_AVX512);
+            else
+            {
+                cout << "Erreur: jeu d'instructions inconnu " << Level << endl;
+                return -1;
+            }
+        }
+        else if (Option == "--math")
+        {
+            string Precision (Value);
+
+            if (Precision == "exact")
+                SetMathPrecision (MATH_EXACT);
+            else if (Precision == "1e-6")
+                SetMathPrecision (MATH_FAST6);
+            else if (Precision == "1e-4")
+                SetMathPrecision (MATH_FAST4);
+            else
+            {
+                cout << "Erreur: precision inconnue " << Precision << endl;
+                return -1;
+            }
+        }
+        else
+        {
+            cout << "Erreur: option inconnue " << Option << endl;
+            Usage (argv [0]);
+            return -1;
+        }
+    }
+
+    if (Opts.TimeStep <= 0)
+    {
+        cout << "Erreur: le pas de temps doit etre positif." << endl;
+        return -1;
+    }
+
+    // The drag has no closed form, it needs an integrator.
+    if (Opts.LinearDrag != 0 || Opts.QuadraticDrag != 0)
+        Opts.Integrating = true;
+
+    if (Opts.Integrating && (Opts.BallNumber > 0 || Opts.Events || ! Opts.FieldFile.empty ()))
+    {
+        cout << "Erreur: le frottement et les integrateurs ne suivent que la balle seule (sans --balls, --events ni --field)." << endl;
+        return -1;
+    }
+
+    // The segments are read once, their hierarchy is built meanwhile.
+    CSegmentTree Segments;
+    if (! Opts.SegmentFile.empty () && ! Segments.Load (Opts.SegmentFile.c_str ()))
+    {
+        cout << "Erreur: impossible de lire les segments de " << Opts.SegmentFile << endl;
+        return -1;
+    }
+
+    CTerrain Terrain;
+    if (! Opts.TerrainFile.empty () && ! Terrain.Load (Opts.TerrainFile.c_str ()))
+    {
+        cout << "Erreur: impossible de lire les hauteurs du sol de " << Opts.TerrainFile << endl;
+        return -1;
+    }
+
+    CPegBoard Board;
+    Board.SetBallRadius (Opts.Radius);
+    if (! Opts.PegFile.empty () && ! Board.Load (Opts.PegFile.c_str ()))
+    {
+        cout << "Erreur: impossible de lire les clous de " << Opts.PegFile << endl;
+        return -1;
+    }
+
+    CForceField Field;
+    if (! Opts.FieldFile.empty () && ! Field.Load (Opts.FieldFile.c_str ()))
+    {
+        cout << "Erreur: impossible de lire le champ de forces de " << Opts.FieldFile << endl;
+        return -1;
+    }
+
+    // The single ball only follows parabolas, in a force field it is stepped by a world.
+    if (! Opts.FieldFile.empty () && Opts.BallNumber == 0)
+        Opts.BallNumber = 1;
+
+    // From deg to rad
+    Parameters.Angle = Parameters.Angle * (float) PI / 180.0;
+    Opts.Spread = Opts.Spread * (float) PI / 180.0;
+
+    /*
+    ** SIMULATION
+    */
+    if (Opts.Checking)
+        return RunChecks (Defaults, DefaultTimeStep);
+
+    if (Opts.MathReport)
+        return RunMathReport (Parameters, Opts);
+
+    if (Opts.IntegratorReport)
+        return RunIntegratorReport (Parameters, Opts);
+
+    if (Opts.Sweeping)
+        return RunSweep (Parameters, Opts);
+
+    if (Opts.Samples > 0)
+        return RunMonteCarlo (Parameters, Opts);
+
+    if (Opts.RefineLevel > 0)
+        return RunAdaptiveSweep (Parameters, Opts);
+
+    if (Opts.Queries > 0)
+        return RunTrajectory (Parameters, Opts);
+
+    if (! Opts.PegFile.empty ())
+        return RunPegBoard (Parameters, Opts, Board);
+
+    if (Opts.BallNumber > 0 && Opts.Events)
+        return RunEventWorld (Parameters, Opts);
+
+    if (Opts.BallNumber > 0)
+        return RunWorld (Parameters, Opts, Segments, Opts.TerrainFile.empty () ? 0 : &Terrain, Opts.FieldFile.empty () ? 0 : &Field);
+
+    if (Opts.Events)
+        return RunEventSimulation (Parameters, Opts);
+
+    return RunSimulation (Parameters, Opts, Segments, Opts.TerrainFile.empty () ? 0 : &Terrain);
+}
@@ -28,6 +28,32 @@ namespace nsTools
     // PI value
     #define PI              3.1415926
 
+    // ARENA WIDTH AND HEIGHT (walls at 0 and ARENA_WIDTH, floor at 0 and roof at ARENA_HEIGHT).
+    #define ARENA_WIDTH     77
+    #define ARENA_HEIGHT    54
+
+    // Under these flight time (s) and upward speed (m/s), the bounces on the floor are not followed anymore and the ball slides.
+    #define REST_FLIGHT_TIME    0.01
+    #define REST_SPEED          0.000001
+
+    // Rolling friction of a ball sliding on the floor, the same in every engine : it slows down by SLIDE_FRICTION * gravity until it stops.
+    #define SLIDE_FRICTION      0.05
+
+    // Under this speed (m/s), a ball sliding on the floor of a world is stopped and put to sleep.
+    #define SLEEP_SPEED         0.001
+
+    // Time (s) the balls of a pile stay slower than SLEEP_SPEED before the whole pile is put to sleep.
+    #define SLEEP_DELAY         0.5
+
+    // Distance (m) left between a ball and the segment, the peg or the terrain it bounced on, so that the next trajectory starts in front of it.
+    #define SURFACE_SKIN        0.0001
+
+    // Collision codes, walls (code & 3) have the values of CollisionDetectionBorder, floor and roof (code >> 2) the values of CollisionDetectionBottomTop.
+    #define COLLISION_LEFT      1
+    #define COLLISION_RIGHT     2
+    #define COLLISION_BOTTOM    (1 << 2)
+    #define COLLISION_TOP       (2 << 2)
+
     // The allowed ball qualities.
     typedef enum{LOW, MEDIUM, HIGH, EXTRA} Quality;
 
@@ -47,5 +73,16 @@ namespace nsTools
         float RestitutionCoef;  //the coefficient the ball have when touching an object.
         Quality Qual;           //the number of vertices of the ball
     };
+
+    // Store the state of a ball at a given time.
+    struct BallState
+    {
+        float X;                //the position of the ball on X axis.
+        float Y;                //the position of the ball on Y axis.
+        float VelX;             //the speed of the ball on X axis.
+        float VelY;             //the speed of the ball on Y axis.
+        unsigned Bounces;       //the number of bounces since the launch.
+        bool Resting;           //tells if the ball stopped bouncing on the floor.
+    };
 }
 #endif // __COMMON_H__
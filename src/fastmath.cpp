@@ -0,0 +1,226 @@
+/**
+ *
+ * @file fastmath.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Fast mathematics source file.
+ *
+ * @details Contain definitions of the trigonometric functions. The sine and cosine are reduced to
+ *          [-PI/4, PI/4] then approximated by a polynomial, the arc cosine uses the Abramowitz and Stegun
+ *          approximations (4.4.45 and 4.4.46).
+ *
+ * @see fastmath.h
+ *
+ **/
+
+#include <math.h>       // sin, cos, acos, sqrt
+#include <atomic>       // std::atomic
+
+#include "fastmath.h"   // Fast mathematics
+
+using namespace nsTools;
+
+namespace
+{
+    // Precision currently used, read once by each call : a change is seen by the next calls of every thread.
+    std::atomic <MathPrecision> g_Precision (MATH_DEFAULT_PRECISION);
+
+    // Return the precision currently used, the order with the other memory accesses does not matter.
+    inline MathPrecision CurrentPrecision ()
+    {
+        return g_Precision.load (std::memory_order_relaxed);
+    }
+
+    // Sine of Y in [-PI/4, PI/4].
+    inline float SinPolynomial (float Y, MathPrecision Precision)
+    {
+        float Y2 = Y * Y;
+
+        // Taylor series up to Y^5, error lower than 4e-5.
+        if (Precision == MATH_FAST4)
+            return Y + Y * Y2 * (-1.6666667e-1f + Y2 * 8.3333333e-3f);
+
+        // Minimax polynomial up to Y^7, error close to the float precision.
+        return Y + Y * Y2 * (-1.6666654611e-1f + Y2 * (8.3321608736e-3f + Y2 * -1.9515295891e-4f));
+    }
+
+    // Cosine of Y in [-PI/4, PI/4].
+    inline float CosPolynomial (float Y, MathPrecision Precision)
+    {
+        float Y2 = Y * Y;
+
+        // Taylor series up to Y^6, error lower than 4e-6.
+        if (Precision == MATH_FAST4)
+            return 1.0f - 0.5f * Y2 + Y2 * Y2 * (4.1666667e-2f + Y2 * -1.3888889e-3f);
+
+        // Minimax polynomial up to Y^8, error close to the float precision.
+        return 1.0f - 0.5f * Y2 + Y2 * Y2 * (4.166664568298827e-2f + Y2 * (-1.388731625493765e-3f + Y2 * 2.443315711809948e-5f));
+    }
+
+    // Reduce X to Y in [-PI/4, PI/4] with X = Y + Quadrant * PI / 2.
+    inline float Reduce (float X, int &Quadrant)
+    {
+        // Rounded to the nearest integer by a conversion, floor is a call to the library without SSE4.1.
+        float Scaled = X * 0.63661977236f;
+        float J = (float) (int) (Scaled + (Scaled < 0 ? -0.5f : 0.5f));
+        Quadrant = (int) J & 3;
+
+        // Two parts of PI / 2 so the subtraction stays exact.
+        return (X - J * 1.5707963705062866f) - J * -4.371139000186241e-08f;
+    }
+}
+
+// Set the precision of the functions.
+void nsTools::SetMathPrecision (MathPrecision Precision) throw ()
+{
+    g_Precision.store (Precision, std::memory_order_relaxed);
+
+}// SetMathPrecision ()
+
+// Return the precision of the functions.
+MathPrecision nsTools::GetMathPrecision () throw ()
+{
+    return CurrentPrecision ();
+
+}// GetMathPrecision ()
+
+// Return the name of a precision.
+const char *nsTools::GetMathPrecisionName (MathPrecision Precision) throw ()
+{
+    if (Precision == MATH_FAST6)
+        return "1e-6";
+    if (Precision == MATH_FAST4)
+        return "1e-4";
+
+    return "exact";
+
+}// GetMathPrecisionName ()
+
+// Will return the sine of X.
+float nsTools::FastSin (float X) throw ()
+{
+    MathPrecision Precision = CurrentPrecision ();
+    if (Precision == MATH_EXACT)
+        return sin (X);
+
+    int Quadrant;
+    float Y = Reduce (X, Quadrant);
+
+    if (Quadrant == 0)
+        return SinPolynomial (Y, Precision);
+    if (Quadrant == 1)
+        return CosPolynomial (Y, Precision);
+    if (Quadrant == 2)
+        return -SinPolynomial (Y, Precision);
+
+    return -CosPolynomial (Y, Precision);
+
+}// FastSin ()
+
+// Will return the cosine of X.
+float nsTools::FastCos (float X) throw ()
+{
+    MathPrecision Precision = CurrentPrecision ();
+    if (Precision == MATH_EXACT)
+        return cos (X);
+
+    int Quadrant;
+    float Y = Reduce (X, Quadrant);
+
+    if (Quadrant == 0)
+        return CosPolynomial (Y, Precision);
+    if (Quadrant == 1)
+        return -SinPolynomial (Y, Precision);
+    if (Quadrant == 2)
+        return -CosPolynomial (Y, Precision);
+
+    return SinPolynomial (Y, Precision);
+
+}// FastCos ()
+
+// Will compute the sine and the cosine of X at once.
+void nsTools::FastSinCos (float X, float &Sin, float &Cos) throw ()
+{
+    MathPrecision Precision = CurrentPrecision ();
+    if (Precision == MATH_EXACT)
+    {
+        Sin = sin (X);
+        Cos = cos (X);
+        return;
+    }
+
+    // Only one reduction for both.
+    int Quadrant;
+    float Y = Reduce (X, Quadrant);
+    float S = SinPolynomial (Y, Precision);
+    float C = CosPolynomial (Y, Precision);
+
+    if (Quadrant == 0)
+    {
+        Sin = S;
+        Cos = C;
+    }
+    else if (Quadrant == 1)
+    {
+        Sin = C;
+        Cos = -S;
+    }
+    else if (Quadrant == 2)
+    {
+        Sin = -S;
+        Cos = -C;
+    }
+    else
+    {
+        Sin = -C;
+        Cos = S;
+    }
+
+}// FastSinCos ()
+
+// Will return the arc cosine of X.
+float nsTools::FastAcos (float X) throw ()
+{
+    MathPrecision Precision = CurrentPrecision ();
+    if (Precision == MATH_EXACT)
+        return acos (X);
+
+    // Work on |X|, acos (-X) = PI - acos (X).
+    bool Negative = X < 0;
+    if (Negative)
+        X = -X;
+    if (X > 1)
+        X = 1;
+
+    float Poly;
+
+    // Abramowitz and Stegun 4.4.45, error lower than 7e-5.
+    if (Precision == MATH_FAST4)
+        Poly = 1.5707288f + X * (-0.2121144f + X * (0.0742610f + X * -0.0187293f));
+
+    // Abramowitz and Stegun 4.4.46, error lower than 2e-8.
+    else
+        Poly = 1.5707963050f + X * (-0.2145988016f + X * (0.0889789874f + X * (-0.0501743046f + X * (0.0308918810f
+             + X * (-0.0170881256f + X * (0.0066700901f + X * -0.0012624911f))))));
+
+    float Result = sqrtf (1.0f - X) * Poly;
+
+    return Negative ? 3.14159265f - Result : Result;
+
+}// FastAcos ()
+
+// Will return the square root of X.
+float nsTools::FastSqrt (float X) throw ()
+{
+    // The float square root is a single hardware instruction, exact to the float precision.
+    if (CurrentPrecision () == MATH_EXACT)
+        return sqrt (X);
+
+    return sqrtf (X);
+
+}// FastSqrt ()
@@ -0,0 +1,61 @@
+/**
+ *
+ * @file fastmath.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Fast mathematics header file.
+ *
+ * @details Contain declaration of the trigonometric functions used by the physics and the matrix transformations.
+ *          They are either the exact libm functions or polynomial approximations in float. The sine and the
+ *          cosine have an absolute error lower than 1e-6 or 1e-4 (their relative error grows near their zeros),
+ *          the arc cosine a relative error lower than 1e-6 or 1e-4, as --math-report measures them. The
+ *          precision is selected at build time (MATH_DEFAULT_PRECISION) and can be changed at run time : it is
+ *          read atomically once per call, but should be set before the threads start so that a run uses only one.
+ *
+ * @see fastmath.cpp
+ *
+ **/
+
+#ifndef __FASTMATH_H__
+#define __FASTMATH_H__
+
+namespace nsTools
+{
+    // The allowed precisions.
+    typedef enum{MATH_EXACT, MATH_FAST6, MATH_FAST4} MathPrecision;
+
+    // Precision used when the program starts, can be set with -DMATH_DEFAULT_PRECISION=MATH_FAST4 for example.
+    #ifndef MATH_DEFAULT_PRECISION
+        #define MATH_DEFAULT_PRECISION MATH_EXACT
+    #endif
+
+    // Set the precision of the functions, for the next calls of every thread.
+    void SetMathPrecision (MathPrecision Precision) throw ();
+
+    // Return the precision of the functions.
+    MathPrecision GetMathPrecision () throw ();
+
+    // Return the name of a precision.
+    const char *GetMathPrecisionName (MathPrecision Precision) throw ();
+
+    // Will return the sine of X (radians).
+    float FastSin (float X) throw ();
+
+    // Will return the cosine of X (radians).
+    float FastCos (float X) throw ();
+
+    // Will compute the sine and the cosine of X at once.
+    void FastSinCos (float X, float &Sin, float &Cos) throw ();
+
+    // Will return the arc cosine of X, in [0, PI].
+    float FastAcos (float X) throw ();
+
+    // Will return the square root of X.
+    float FastSqrt (float X) throw ();
+}
+#endif // __FASTMATH_H__
@@ -0,0 +1,473 @@
+/**
+ *
+ * @file physics.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Physics source file.
+ *
+ * @details Contain definitions of the trajectory and collision functions.
+ *
+ * @see physics.h
+ *
+ **/
+
+#include <math.h>       // cos, sin, acos, sqrt, cbrt, fabs, ceil, log, pow
+#include <utility>      // std::pairs
+#include <array>        // std::array
+
+#include "physics.h"    // Physics
+#include "fastmath.h"   // FastSin, FastCos, FastAcos, FastSqrt
+#include "common.h"     // struct
+
+using namespace std;
+
+// Will return the pair (x, y) coordinates of the center of the ball at time = t.
+pair <float, float> nsTools::PositionComputing (const nsTools::Settings &Sets, float Xmax) throw ()
+{
+    // Initialize the two coordinates
+    float X (0);
+    float Y (0);
+
+    // Get both at once, the angle is the same.
+    float Sin;
+    float Cos;
+    FastSinCos (Sets.Angle, Sin, Cos);
+
+    // If the ball goes from left to the right
+    if (Sets.Dir == LEFTTORIGHT)
+        X = Xmax + Sets.Speed * Cos * Sets.Time;
+    // If from right to the left
+    else
+        X = Xmax - Sets.Speed * Cos * Sets.Time;
+
+    // Always the same from left to right and from right to left
+    Y = Sets.InitPos + Sets.Speed * Sin * Sets.Time - (1.0 / 2.0 * Sets.Gravity * Sets.Time * Sets.Time);
+
+    // Create and and return the brand new pair of coordinates.
+    return make_pair (X, Y);
+
+}// PositionComputing ()
+
+// Will return the angle of the ball and the wall or floor just before the impact.
+float nsTools::AngleComputing (pair <float, float> Point1, pair <float, float> Point2, bool Vertical, Direction Dir) throw ()
+{
+    // Create the vector from the trajectory.
+    array <float, 2> V = { {Point2.first - Point1.first, Point2.second - Point1.second} };
+
+    // Declare the vector of the wall or floor.
+    array <float, 2> U;
+
+    // If vertical movement
+    if (Vertical)
+    {
+       // Create the vector parts of the second line.
+        U[0] = 0;
+        U[1] = 1;
+    }
+    else
+    {
+        //Create the vector parts of the second line.
+        if (Dir == LEFTTORIGHT)
+            U[0] = 1;
+        else
+            U[0] = -1;
+
+        U[1] = 0;
+    }
+
+    // Get the cos (angle)
+    float CosAngle = (V[0] * U[0] + V[1] * U[1]) / FastSqrt ((V[0] * V[0] + V[1] * V[1]) * (U[0] * U[0] + U[1] * U[1]));
+
+    // Return the Angle in radiant.
+    return FastAcos (CosAngle);
+
+}//AngleComputing ()
+
+// Will return the speed for X axis and Y axis
+pair <float, float> nsTools::SpeedComputing (float InitSpeed, float Angle)
+{
+    // Create a pair of float the first for y, the second for x
+    pair <float,float> Speed;
+
+    float Sin;
+    float Cos;
+    FastSinCos (Angle, Sin, Cos);
+
+    Speed.first = InitSpeed * Sin;
+    Speed.second = InitSpeed * Cos;
+
+    // Return the speed for X axis and for the Y axis
+    return Speed;
+}
+
+// Collision detection on the two walls.
+unsigned nsTools::CollisionDetectionBorder (float XObj) throw ()
+{
+    // If left
+    if (XObj < 0)
+        return 1;
+    //If right
+    if (XObj > ARENA_WIDTH)
+        return 2;
+
+    // Else
+    return 0;
+
+}// CollisionDetectionBorder ()
+
+// Collision detection on the floor and roof.
+unsigned nsTools::CollisionDetectionBottomTop (float YObj) throw ()
+{
+    // If bottom
+    if (YObj < 0)
+        return 1;
+    // If top
+    if (YObj > ARENA_HEIGHT)
+        return 2;
+
+    // Else
+    return 0;
+
+}// CollisionDetectionBottom ()
+
+// Will reflect the velocity on the surfaces of Code, the normal component being scaled by the coefficient.
+unsigned nsTools::ReflectionComputing (float &VelX, float &VelY, unsigned Code, float RestitutionCoef) throw ()
+{
+    unsigned Surfaces = 0;
+
+    // The ball always goes back inside the arena.
+    if (Code & COLLISION_LEFT)
+    {
+        VelX = fabs (VelX) * RestitutionCoef;
+        ++Surfaces;
+    }
+    if (Code & COLLISION_RIGHT)
+    {
+        VelX = -fabs (VelX) * RestitutionCoef;
+        ++Surfaces;
+    }
+    if (Code & COLLISION_BOTTOM)
+    {
+        VelY = fabs (VelY) * RestitutionCoef;
+        ++Surfaces;
+    }
+    if (Code & COLLISION_TOP)
+    {
+        VelY = -fabs (VelY) * RestitutionCoef;
+        ++Surfaces;
+    }
+
+    return Surfaces;
+
+}// ReflectionComputing ()
+
+// Will reflect the velocity on a surface of unit normal (NX, NY), the normal component being scaled by the coefficient.
+bool nsTools::SurfaceReflectionComputing (float &VelX, float &VelY, float NX, float NY, float RestitutionCoef, float Gravity, float MinFlightTime) throw ()
+{
+    float Normal = VelX * NX + VelY * NY;
+    float Reflected = Normal < 0 ? -Normal * RestitutionCoef : 0;
+
+    // The gravity brings the ball back on a surface facing up after 2 * Reflected / (Gravity * NY) seconds.
+    bool Bounced = Reflected > 0 && (NY <= 0 || Gravity <= 0 || 2 * Reflected >= MinFlightTime * Gravity * NY);
+    if (! Bounced)
+        Reflected = 0;
+
+    // Only the normal component changes, the ball keeps sliding along the surface.
+    if (Normal < 0)
+    {
+        VelX += (Reflected - Normal) * NX;
+        VelY += (Reflected - Normal) * NY;
+    }
+
+    return Bounced;
+
+}// SurfaceReflectionComputing ()
+
+// Will return the vertical velocity of the ball when it went through the floor or the roof.
+float nsTools::ImpactVelocityComputing (float VelY, float Y, float Gravity) throw ()
+{
+    // Distance under the floor (negative) or over the roof (positive) at the end of the step.
+    float Height = 0;
+    if (Y < 0)
+        Height = Y;
+    else if (Y > ARENA_HEIGHT)
+        Height = Y - ARENA_HEIGHT;
+
+    // Conservation of the energy between the impact and the end of the step.
+    float Square = VelY * VelY + 2 * Gravity * Height;
+    float Speed = Square > 0 ? sqrt (Square) : 0;
+
+    return VelY < 0 ? -Speed : Speed;
+
+}// ImpactVelocityComputing ()
+
+// Will return the point moved back inside the arena, on the surfaces it went through.
+pair <float, float> nsTools::ClampComputing (pair <float, float> Point) throw ()
+{
+    if (Point.first < 0)
+        Point.first = 0;
+    if (Point.first > ARENA_WIDTH)
+        Point.first = ARENA_WIDTH;
+    if (Point.second < 0)
+        Point.second = 0;
+    if (Point.second > ARENA_HEIGHT)
+        Point.second = ARENA_HEIGHT;
+
+    return Point;
+
+}// ClampComputing ()
+
+// Will return the time left before the ball, leaving the floor at VelY, stops bouncing, Bounces receives the number of bounces left.
+double nsTools::RestComputing (double VelY, double Gravity, double RestitutionCoef, double MinFlightTime, unsigned &Bounces) throw ()
+{
+    Bounces = 0;
+
+    // Already lying on the floor.
+    if (VelY < REST_SPEED || RestitutionCoef <= 0)
+        return 0;
+
+    // The bounces never decrease.
+    if (Gravity <= 0 || RestitutionCoef >= 1)
+        return -1;
+
+    // The bounces are still visible.
+    double Flight = 2 * VelY / Gravity;
+    if (Flight >= MinFlightTime)
+        return -1;
+
+    // The upward speed after k bounces is VelY * e^k, the last bounce is the first one under REST_SPEED.
+    double Count = ceil (log (REST_SPEED / VelY) / log (RestitutionCoef));
+    if (Count < 1)
+        Count = 1;
+
+    Bounces = (unsigned) Count;
+    while (Bounces > 1 && VelY * pow (RestitutionCoef, Bounces - 1) < REST_SPEED)
+        --Bounces;
+    while (VelY * pow (RestitutionCoef, Bounces) >= REST_SPEED)
+        ++Bounces;
+
+    // The k-th flight lasts Flight * e^k.
+    return Flight * (1 - pow (RestitutionCoef, Bounces)) / (1 - RestitutionCoef);
+
+}// RestComputing ()
+
+// Will return the first time t >= 0 when A * t * t + B * t + C crosses 0 upward (Rising) or downward.
+double nsTools::CrossingComputing (double A, double B, double C, bool Rising) throw ()
+{
+    // The two roots, sorted.
+    double Roots [2];
+    unsigned RootNumber = 0;
+
+    // Linear case (no gravity or wall).
+    if (A == 0)
+    {
+        if (B == 0)
+            return -1;
+
+        Roots [RootNumber++] = -C / B;
+    }
+    else
+    {
+        double Delta = B * B - 4 * A * C;
+        if (Delta < 0)
+            return -1;
+
+        // Stable form of the two roots, without cancellation.
+        double Q = -0.5 * (B + (B < 0 ? -sqrt (Delta) : sqrt (Delta)));
+
+        Roots [RootNumber++] = Q / A;
+        if (Q != 0)
+            Roots [RootNumber++] = C / Q;
+
+        if (RootNumber == 2 && Roots [1] < Roots [0])
+        {
+            double Temp = Roots [0];
+            Roots [0] = Roots [1];
+            Roots [1] = Temp;
+        }
+    }
+
+    // Keep the first root in the future where the curve goes the right way (or is tangent and then bends the right way).
+    for (unsigned i = 0; i < RootNumber; ++i)
+    {
+        double Slope = 2 * A * Roots [i] + B;
+
+        if (Slope == 0)
+            Slope = A;
+
+        if (Roots [i] >= 0 && ((Rising && Slope > 0) || (! Rising && Slope < 0)))
+            return Roots [i];
+    }
+
+    return -1;
+
+}// CrossingComputing ()
+
+// Will put in Roots the real roots of A * t^3 + B * t^2 + C * t + D, sorted, and return their number.
+unsigned nsTools::CubicComputing (double A, double B, double C, double D, double Roots [3]) throw ()
+{
+    unsigned RootNumber = 0;
+
+    // Not a cubic, the roots of the quadratic.
+    if (A == 0)
+    {
+        if (B == 0)
+        {
+            if (C != 0)
+                Roots [RootNumber++] = -D / C;
+            return RootNumber;
+        }
+
+        double Delta = C * C - 4 * B * D;
+        if (Delta < 0)
+            return 0;
+
+        double Q = -0.5 * (C + (C < 0 ? -sqrt (Delta) : sqrt (Delta)));
+        Roots [RootNumber++] = Q / B;
+        if (Q != 0)
+            Roots [RootNumber++] = D / Q;
+    }
+    else
+    {
+        // Depressed cubic u^3 + P * u + Q with t = u - B / 3A.
+        double b = B / A;
+        double c = C / A;
+        double d = D / A;
+        double P = c - b * b / 3;
+        double Q = 2 * b * b * b / 27 - b * c / 3 + d;
+        double Delta = Q * Q / 4 + P * P * P / 27;
+
+        if (Delta > 0)
+        {
+            // One real root (Cardano).
+            double Sqrt = sqrt (Delta);
+            Roots [RootNumber++] = cbrt (-Q / 2 + Sqrt) + cbrt (-Q / 2 - Sqrt) - b / 3;
+        }
+        else
+        {
+            // Three real roots (trigonometric form).
+            double Radius = 2 * sqrt (-P / 3);
+            double Cos = Radius > 0 ? 3 * Q / (P * Radius) : 0;
+            double Angle = acos (Cos < -1 ? -1 : (Cos > 1 ? 1 : Cos)) / 3;
+
+            for (unsigned k = 0; k < 3; ++k)
+                Roots [RootNumber++] = Radius * cos (Angle - 2 * PI * k / 3) - b / 3;
+        }
+
+        // One Newton iteration to correct the rounding errors.
+        for (unsigned i = 0; i < RootNumber; ++i)
+        {
+            double t = Roots [i];
+            double Slope = (3 * A * t + 2 * B) * t + C;
+            if (Slope != 0)
+                Roots [i] = t - (((A * t + B) * t + C) * t + D) / Slope;
+        }
+    }
+
+    // Sort the roots.
+    for (unsigned i = 1; i < RootNumber; ++i)
+        for (unsigned j = i; j > 0 && Roots [j] < Roots [j - 1]; --j)
+        {
+            double Temp = Roots [j];
+            Roots [j] = Roots [j - 1];
+            Roots [j - 1] = Temp;
+        }
+
+    return RootNumber;
+
+}// CubicComputing ()
+
+// Will return the first time t >= 0 when two balls come at Distance from each other, a negative value if never.
+double nsTools::ContactComputing (double DX, double DY, double DVX, double DVY, double DAX, double DAY, double Distance) throw ()
+{
+    // Square of the distance minus Distance^2 : A4 * t^4 + A3 * t^3 + A2 * t^2 + A1 * t + A0.
+    double HX = 0.5 * DAX;
+    double HY = 0.5 * DAY;
+    double A4 = HX * HX + HY * HY;
+    double A3 = 2 * (DVX * HX + DVY * HY);
+    double A2 = DVX * DVX + DVY * DVY + 2 * (DX * HX + DY * HY);
+    double A1 = 2 * (DX * DVX + DY * DVY);
+    double A0 = DX * DX + DY * DY - Distance * Distance;
+
+    // Already in contact and getting closer.
+    if (A0 <= 0 && A1 < 0)
+        return 0;
+
+    // Same acceleration, the relative motion is a straight line.
+    if (A4 == 0)
+        return CrossingComputing (A2, A1, A0, false);
+
+    // The function is monotonic between its critical points, look for the first interval where it goes under 0.
+    double Bounds [4];
+    unsigned BoundNumber = CubicComputing (4 * A4, 3 * A3, 2 * A2, A1, Bounds);
+
+    double Low = 0;
+    double LowValue = A0;
+
+    for (unsigned i = 0; i < BoundNumber; ++i)
+    {
+        double High = Bounds [i];
+        if (High <= Low)
+            continue;
+
+        double HighValue = (((A4 * High + A3) * High + A2) * High + A1) * High + A0;
+
+        // Found, the root is bracketed : bisection.
+        if (LowValue > 0 && HighValue <= 0)
+        {
+            for (unsigned Iteration = 0; Iteration < 100 && High - Low > 1e-12 * (1 + High); ++Iteration)
+            {
+                double Middle = 0.5 * (Low + High);
+                double Value = (((A4 * Middle + A3) * Middle + A2) * Middle + A1) * Middle + A0;
+
+                if (Value > 0)
+                    Low = Middle;
+                else
+                    High = Middle;
+            }
+
+            return Low;
+        }
+
+        Low = High;
+        LowValue = HighValue;
+    }
+
+    // After the last critical point the function grows forever.
+    return -1;
+
+}// ContactComputing ()
+
+// Will return the time before the ball touches a wall, the floor or the roof, Code tells which ones.
+double nsTools::ImpactComputing (double X, double Y, double VelX, double VelY, double Gravity, unsigned &Code, double Friction/* = 0*/) throw ()
+{
+    // Time before every impact, X(t) = X + VelX * t - Friction * t * t / 2 and Y(t) = Y + VelY * t - Gravity * t * t / 2.
+    double Times [4] = {CrossingComputing (-0.5 * Friction, VelX, X, false),
+                        CrossingComputing (-0.5 * Friction, VelX, X - ARENA_WIDTH, true),
+                        CrossingComputing (-0.5 * Gravity, VelY, Y, false),
+                        CrossingComputing (-0.5 * Gravity, VelY, Y - ARENA_HEIGHT, true)};
+    const unsigned Codes [4] = {COLLISION_LEFT, COLLISION_RIGHT, COLLISION_BOTTOM, COLLISION_TOP};
+
+    // Get the first impact.
+    double First = -1;
+    for (unsigned i = 0; i < 4; ++i)
+        if (Times [i] >= 0 && (First < 0 || Times [i] < First))
+            First = Times [i];
+
+    // Get every surface touched at this time, two for a corner.
+    Code = 0;
+    if (First < 0)
+        return -1;
+
+    for (unsigned i = 0; i < 4; ++i)
+        if (Times [i] >= 0 && Times [i] - First <= 1e-9 * (1 + First))
+            Code |= Codes [i];
+
+    return First;
+
+}// ImpactComputing ()
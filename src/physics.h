@@ -0,0 +1,77 @@
+/**
+ *
+ * @file physics.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Physics header file.
+ *
+ * @details Contain declaration of the trajectory and collision functions.
+ *          This file must not depend on SDL, GLEW or glm so it can be used by the headless simulation.
+ *
+ * @see physics.cpp
+ *
+ **/
+
+#ifndef __PHYSICS_H__
+#define __PHYSICS_H__
+
+#include <utility>      // std::pair
+
+#include "common.h"     // Settings struct
+
+namespace nsTools
+{
+    // Will return the pair (x, y) coordinates of the center of the ball at time = t.
+    std::pair <float, float> PositionComputing (const Settings &Sets, float Xmax) throw ();
+
+    // Will return the angle of the ball and the wall or floor just before the impact.
+    float AngleComputing (std::pair <float, float> Point1, std::pair <float, float> Point2, bool Vertical, Direction Dir) throw ();
+
+    // Will return the speed for X axis and Y axis
+    std::pair <float, float> SpeedComputing (float InitSpeed, float Angle);
+
+    // Collision detection on the two walls.
+    unsigned CollisionDetectionBorder (float XObj) throw ();
+
+    // Collision detection on the floor.
+    unsigned CollisionDetectionBottomTop (float YObj) throw ();
+
+    // Will reflect the velocity on the surfaces of Code (COLLISION codes), the normal component being scaled by the coefficient.
+    // Return the number of touched surfaces.
+    unsigned ReflectionComputing (float &VelX, float &VelY, unsigned Code, float RestitutionCoef) throw ();
+
+    // Will reflect the velocity on a surface of unit normal (NX, NY), the normal component being scaled by the coefficient.
+    // Return false if the flight off the surface is shorter than MinFlightTime : the normal component is removed and the ball slides along it.
+    bool SurfaceReflectionComputing (float &VelX, float &VelY, float NX, float NY, float RestitutionCoef, float Gravity, float MinFlightTime) throw ();
+
+    // Will return the vertical velocity of the ball when it went through the floor or the roof, Y being its position at the end of the step.
+    // The speed gained or lost under the floor or over the roof is removed, so that the bounces do not gain energy.
+    float ImpactVelocityComputing (float VelY, float Y, float Gravity) throw ();
+
+    // Will return the point moved back inside the arena, on the surfaces it went through.
+    std::pair <float, float> ClampComputing (std::pair <float, float> Point) throw ();
+
+    // Will return the time left before the ball, leaving the floor at VelY, stops bouncing, Bounces receives the number of bounces left.
+    // The bounces of a flight shorter than MinFlightTime are summed as a geometric series, a negative value is returned if the flight is longer.
+    double RestComputing (double VelY, double Gravity, double RestitutionCoef, double MinFlightTime, unsigned &Bounces) throw ();
+
+    // Will return the first time t >= 0 when A * t * t + B * t + C crosses 0 upward (Rising) or downward, a negative value if never.
+    double CrossingComputing (double A, double B, double C, bool Rising) throw ();
+
+    // Will put in Roots the real roots of A * t^3 + B * t^2 + C * t + D, sorted, and return their number.
+    unsigned CubicComputing (double A, double B, double C, double D, double Roots [3]) throw ();
+
+    // Will return the first time t >= 0 when two balls come at Distance from each other, a negative value if never.
+    // (DX, DY) goes from the first ball to the second one, (DVX, DVY) and (DAX, DAY) are the relative velocity and acceleration.
+    double ContactComputing (double DX, double DY, double DVX, double DVY, double DAX, double DAY, double Distance) throw ();
+
+    // Will return the time before the ball touches a wall, the floor or the roof, Code tells which ones (COLLISION codes).
+    // A negative value is returned if the ball never touches anything. Friction slows down the horizontal velocity.
+    double ImpactComputing (double X, double Y, double VelX, double VelY, double Gravity, unsigned &Code, double Friction = 0) throw ();
+}
+#endif // __PHYSICS_H__
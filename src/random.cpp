@@ -0,0 +1,74 @@
+/**
+ *
+ * @file random.cpp
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Random numbers source file.
+ *
+ * @details Contain definitions of the random functions. A Philox round multiplies two words of the counter by
+ *          constants, and mixes the high and low halves of the products with the two other words and the key.
+ *          The key is increased between the rounds (Weyl sequence).
+ *
+ * @see random.h
+ *
+ **/
+
+#include <math.h>       // sqrt, log, cos
+
+#include "random.h"     // Random numbers
+#include "common.h"     // PI
+
+namespace
+{
+    // Multipliers of the rounds and increments of the key.
+    const unsigned long long Multiplier0 = 0xD2511F53;
+    const unsigned long long Multiplier1 = 0xCD9E8D57;
+    const unsigned Weyl0 = 0x9E3779B9;
+    const unsigned Weyl1 = 0xBB67AE85;
+
+    // Number of rounds, 10 pass the BigCrush tests with a margin.
+    const unsigned RoundNumber = 10;
+}
+
+// Replace the counter by the random words of the block.
+void nsTools::Philox (unsigned Counter [4], const unsigned Key [2]) throw ()
+{
+    unsigned Key0 = Key [0];
+    unsigned Key1 = Key [1];
+
+    for (unsigned Round = 0; Round < RoundNumber; ++Round)
+    {
+        unsigned long long Product0 = Multiplier0 * Counter [0];
+        unsigned long long Product1 = Multiplier1 * Counter [2];
+
+        unsigned New [4] = {(unsigned) (Product1 >> 32) ^ Counter [1] ^ Key0, (unsigned) Product1,
+                            (unsigned) (Product0 >> 32) ^ Counter [3] ^ Key1, (unsigned) Product0};
+
+        for (unsigned i = 0; i < 4; ++i)
+            Counter [i] = New [i];
+
+        Key0 += Weyl0;
+        Key1 += Weyl1;
+    }
+
+}// Philox ()
+
+// Will return a number uniformly distributed in ]0, 1[.
+double nsTools::UniformComputing (unsigned Word) throw ()
+{
+    // The middle of the 2^32 intervals, neither 0 nor 1.
+    return (Word + 0.5) / 4294967296.0;
+
+}// UniformComputing ()
+
+// Will return a number of the standard normal law.
+double nsTools::NormalComputing (unsigned First, unsigned Second) throw ()
+{
+    return sqrt (-2 * log (UniformComputing (First))) * cos (2 * PI * UniformComputing (Second));
+
+}// NormalComputing ()
@@ -0,0 +1,35 @@
+/**
+ *
+ * @file random.h
+ *
+ * @authors : G. Tricaud, R. Soulier, G. Vigneau, A. Torres Aurora Dugo
+ *
+ * @date : 17/10/2026
+ *
+ * @version : 1.0
+ *
+ * @brief Random numbers header file.
+ *
+ * @details Contain declaration of the counter-based random generator Philox4x32-10 (Salmon et al., 2011) and of the
+ *          laws drawn from its output. The numbers are a function of a counter and a key, without any state : the
+ *          sample of index i is the same whatever the thread computing it and the samples computed before.
+ *
+ * @see random.cpp
+ *
+ **/
+
+#ifndef __RANDOM_H__
+#define __RANDOM_H__
+
+namespace nsTools
+{
+    // Replace the 4 words of Counter by the 4 random words of the block Counter of the stream Key.
+    void Philox (unsigned Counter [4], const unsigned Key [2]) throw ();
+
+    // Will return a number uniformly distributed in ]0, 1[ from a random word.
+    double UniformComputing (unsigned Word) throw ();
+
+    // Will return a number of the standard normal law from two random words (Box-Muller).
+    double NormalComputing (unsigned First, unsigned Second) throw ();
+}
+#endif // __RANDOM_H__
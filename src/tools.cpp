@@ -35,79 +35,10 @@
 #include "CSceneOpenGL.h"   // Scene OpenGL
 #include "tools.h"          // Tools
 #include "common.h"         // struct
+#include "fastmath.h"       // FastSinCos
 
 using namespace std;
 
-// Will return the pair (x, y) coordinates of the center of the ball at time = t.
-pair <float, float> nsTools::PositionComputing (const nsTools::Settings &Sets, float Xmax) throw ()
-{
-    // Initialize the two coordinates
-    float X (0);
-    float Y (0);
-
-    // If the ball goes from left to the right
-    if (Sets.Dir == LEFTTORIGHT)
-        X = Xmax + Sets.Speed * cos (Sets.Angle) * Sets.Time;
-    // If from right to the left
-    else
-        X = Xmax - Sets.Speed * cos (Sets.Angle) * Sets.Time;
-
-    // Always the same from left to right and from right to left
-    Y = Sets.InitPos + Sets.Speed * sin (Sets.Angle) * Sets.Time - (1.0 / 2.0 * Sets.Gravity * Sets.Time * Sets.Time);
-
-    // Create and and return the brand new pair of coordinates.
-    return make_pair (X, Y);
-
-}// PositionComputing ()
-
-// Will return the angle of the ball and the wall or floor just before the impact.
-float nsTools::AngleComputing (pair <float, float> Point1, pair <float, float> Point2, bool Vertical, Direction Dir) throw ()
-{
-    // Create the vector from the trajectory.
-    array <float, 2> V = { {Point2.first - Point1.first, Point2.second - Point1.second} };
-
-    // Declare the vector of the wall or floor.
-    array <float, 2> U;
-
-    // If vertical movement
-    if (Vertical)
-    {
-       // Create the vector parts of the second line.
-        U[0] = 0;
-        U[1] = 1;
-    }
-    else
-    {
-        //Create the vector parts of the second line.
-        if (Dir == LEFTTORIGHT)
-            U[0] = 1;
-        else
-            U[0] = -1;
-
-        U[1] = 0;
-    }
-
-    // Get the cos (angle)
-    float CosAngle = (V[0] * U[0] + V[1] * U[1]) / sqrt((V[0] * V[0] + V[1] * V[1]) * (U[0] * U[0] + U[1] * U[1]));
-
-    // Return the Angle in radiant.
-    return acos (CosAngle);
-
-}//AngleComputing ()
-
-// Will return the speed for X axis and Y axis
-pair <float, float> nsTools::SpeedComputing (float InitSpeed, float Angle)
-{
-    // Create a pair of float the first for y, the second for x
-    pair <float,float> Speed;
-
-    Speed.first = InitSpeed * sin (Angle);
-    Speed.second = InitSpeed * cos (Angle);
-
-    // Return the speed for X axis and for the Y axis
-    return Speed;
-}
-
 // Test is a string only contains digits.
 bool nsTools::StringIsDigit (const stringstream &sstream) throw ()
 {
@@ -339,6 +270,12 @@ void nsTools::Rotate (float *Mat, unsigned MatSize, float Angle, float x, float
 // Rotate a matrix.
 void nsTools::Rotate (float *Mat, unsigned MatSize, float AngleX, float AngleY, float AngleZ) throw ()
 {
+    // Compute the sine and cosine of every angle once.
+    float SinX, CosX, SinY, CosY, SinZ, CosZ;
+    FastSinCos (AngleX, SinX, CosX);
+    FastSinCos (AngleY, SinY, CosY);
+    FastSinCos (AngleZ, SinZ, CosZ);
+
     // Create the matrix to allow rotate on X axis by multiplying it to the old matrix.
     float RotateXMat [4][4];
 
@@ -349,13 +286,13 @@ void nsTools::Rotate (float *Mat, unsigned MatSize, float AngleX, float AngleY,
     RotateXMat [0][3] = 0;
 
     RotateXMat [1][0] = 0;
-    RotateXMat [1][1] = cos (AngleX);
-    RotateXMat [1][2] = -sin (AngleX);
+    RotateXMat [1][1] = CosX;
+    RotateXMat [1][2] = -SinX;
     RotateXMat [1][3] = 0;
 
     RotateXMat [2][0] = 0;
-    RotateXMat [2][1] = sin (AngleX);
-    RotateXMat [2][2] = cos (AngleX);
+    RotateXMat [2][1] = SinX;
+    RotateXMat [2][2] = CosX;
     RotateXMat [2][3] = 0;
 
     RotateXMat [3][0] = 0;
@@ -381,9 +318,9 @@ void nsTools::Rotate (float *Mat, unsigned MatSize, float AngleX, float AngleY,
     float RotateYMat [4][4];
 
     // Fill the Y rotation matrix.
-    RotateYMat [0][0] = cos (AngleY);
+    RotateYMat [0][0] = CosY;
     RotateYMat [0][1] = 0;
-    RotateYMat [0][2] = sin (AngleY);
+    RotateYMat [0][2] = SinY;
     RotateYMat [0][3] = 0;
 
     RotateYMat [1][0] = 0;
@@ -391,9 +328,9 @@ void nsTools::Rotate (float *Mat, unsigned MatSize, float AngleX, float AngleY,
     RotateYMat [1][2] = 0;
     RotateYMat [1][3] = 0;
 
-    RotateYMat [2][0] = -sin (AngleY);
+    RotateYMat [2][0] = -SinY;
     RotateYMat [2][1] = 0;
-    RotateYMat [2][2] = cos (AngleY);
+    RotateYMat [2][2] = CosY;
     RotateYMat [2][3] = 0;
 
     RotateYMat [3][0] = 0;
@@ -419,13 +356,13 @@ void nsTools::Rotate (float *Mat, unsigned MatSize, float AngleX, float AngleY,
     float RotateZMat [4][4];
 
     // Fill the Z rotation matrix
-    RotateZMat [0][0] = cos (AngleZ);
-    RotateZMat [0][1] = -sin (AngleZ);
+    RotateZMat [0][0] = CosZ;
+    RotateZMat [0][1] = -SinZ;
     RotateZMat [0][2] = 0;
     RotateZMat [0][3] = 0;
 
-    RotateZMat [1][0] = sin (AngleZ);
-    RotateZMat [1][1] = cos (AngleZ);
+    RotateZMat [1][0] = SinZ;
+    RotateZMat [1][1] = CosZ;
     RotateZMat [1][2] = 0;
     RotateZMat [1][3] = 0;
 
@@ -570,36 +507,6 @@ void nsTools::Multiply (float *MatToMul, float TransFormMat[4][4]) throw ()
     }
 }// Multiply ()
 
-// Collision detection on the two walls.
-unsigned nsTools::CollisionDetectionBorder (float XObj) throw ()
-{
-    // If left
-    if (XObj < 0)
-        return 1;
-    //If right
-    if (XObj > 77)
-        return 2;
-
-    // Else
-    return 0;
-
-}// CollisionDetectionBorder ()
-
-// Collision detection on the floor and roof.
-unsigned nsTools::CollisionDetectionBottomTop (float YObj) throw ()
-{
-    // If bottom
-    if (YObj < 0)
-        return 1;
-    // If top
-    if (YObj > 54)
-        return 2;
-
-    // Else
-    return 0;
-
-}// CollisionDetectionBottom ()
-
 // Will display information about the simulation.
 void nsTools::DisplayInformation (Settings Parameters, float CurrentAngle, std::pair <float, float> New)
 {
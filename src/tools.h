@@ -37,18 +37,10 @@
 #include "Shader.h"         // Shaders class
 #include "CSceneOpenGL.h"   // Scene OpenGL
 #include "common.h"         // struct
+#include "physics.h"        // Trajectory and collision functions
 
 namespace nsTools
 {
-    // Will return the pair (x, y) coordinates of the center of the ball at time = t.
-    std::pair <float, float> PositionComputing (const Settings &Sets, float Xmax) throw ();
-
-    // Will return the angle of the ball and the wall or floor just before the impact.
-    float AngleComputing (std::pair <float, float> Point1, std::pair <float, float> Point2, bool Vertical, Direction Dir) throw ();
-
-    // Will return the speed for X axis and Y axis
-    std::pair <float, float> SpeedComputing (float InitSpeed, float Angle);
-
     // Test is a string only contains digits.
     bool StringIsDigit (const std::stringstream &sstream) throw ();
 
@@ -67,12 +59,6 @@ namespace nsTools
     // Multiply two matrix.
     void Multiply (float *MatToMul, float TransMat[4][4]) throw ();
 
-    // Collision detection on the two walls.
-    unsigned CollisionDetectionBorder (float XObj) throw ();
-
-    // Collision detection on the floor.
-    unsigned CollisionDetectionBottomTop (float YObj) throw ();
-
     // Will display information about the simulation.
     void DisplayInformation (Settings parameter, float CurrentAngle, std::pair <float, float> New);
 }